@@ -0,0 +1,324 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_constraints/linear_equation_eq.hpp>
+#include <ghost/global_constraints/linear_equation_leq.hpp>
+#include <ghost/global_constraints/no_overlap.hpp>
+#include <ghost/global_constraints/not_equal_network.hpp>
+#include <ghost/global_objectives/bottleneck_objective.hpp>
+#include <ghost/global_objectives/linear_objective.hpp>
+
+#include "builders.hpp"
+#include "constraints.hpp"
+
+using namespace ghost::global_constraints;
+using namespace ghost::global_objectives;
+
+namespace
+{
+	constexpr unsigned int instance_seed = 42;
+}
+
+/*************
+ * N-Queens *
+ *************/
+QueensBuilder::QueensBuilder( int size )
+	: ModelBuilder( true ),
+	  _size( size )
+{ }
+
+void QueensBuilder::declare_variables()
+{
+	for( int row = 0 ; row < _size ; ++row )
+		variables.emplace_back( 0, _size, row );
+}
+
+void QueensBuilder::declare_constraints()
+{
+	constraints.emplace_back( std::make_shared<QueensDiagonals>( variables ) );
+}
+
+/****************
+ * Magic square *
+ ****************/
+MagicSquareBuilder::MagicSquareBuilder( int order )
+	: ModelBuilder( true ),
+	  _order( order )
+{ }
+
+void MagicSquareBuilder::declare_variables()
+{
+	for( int cell = 0 ; cell < _order * _order ; ++cell )
+		variables.emplace_back( 1, _order * _order, cell );
+}
+
+void MagicSquareBuilder::declare_constraints()
+{
+	double sum = _order * ( _order * _order + 1 ) / 2;
+	std::vector<int> diagonal( _order );
+	std::vector<int> anti_diagonal( _order );
+
+	for( int i = 0 ; i < _order ; ++i )
+	{
+		std::vector<int> row( _order );
+		std::vector<int> column( _order );
+		for( int j = 0 ; j < _order ; ++j )
+		{
+			row[ j ] = i * _order + j;
+			column[ j ] = j * _order + i;
+		}
+
+		constraints.emplace_back( std::make_shared<LinearEquationEq>( row, sum ) );
+		constraints.emplace_back( std::make_shared<LinearEquationEq>( column, sum ) );
+
+		diagonal[ i ] = i * _order + i;
+		anti_diagonal[ i ] = i * _order + _order - 1 - i;
+	}
+
+	constraints.emplace_back( std::make_shared<LinearEquationEq>( diagonal, sum ) );
+	constraints.emplace_back( std::make_shared<LinearEquationEq>( anti_diagonal, sum ) );
+}
+
+/****************
+ * Golomb ruler *
+ ****************/
+GolombBuilder::GolombBuilder( int marks )
+	: ModelBuilder(),
+	  _marks( marks )
+{
+	// Optimal lengths from 2 to 12 marks
+	std::vector<int> optimal_lengths{ 1, 3, 6, 11, 17, 25, 34, 44, 55, 72, 85 };
+	_length = optimal_lengths.at( marks - 2 );
+}
+
+void GolombBuilder::declare_variables()
+{
+	create_n_variables( _marks, 0, _length + 1 );
+}
+
+void GolombBuilder::declare_constraints()
+{
+	constraints.emplace_back( std::make_shared<GolombRuler>( variables, _length ) );
+}
+
+/******************
+ * Graph coloring *
+ ******************/
+ColoringBuilder::ColoringBuilder( int vertices, int colors, double density )
+	: ModelBuilder(),
+	  _vertices( vertices ),
+	  _colors( colors )
+{
+	std::mt19937 rng( instance_seed );
+	std::uniform_int_distribution<int> color( 0, colors - 1 );
+	std::bernoulli_distribution is_edge( density );
+
+	std::vector<int> planted( vertices );
+	for( auto& c : planted )
+		c = color( rng );
+
+	for( int i = 0 ; i < vertices ; ++i )
+		for( int j = i + 1 ; j < vertices ; ++j )
+			if( planted[ i ] != planted[ j ] && is_edge( rng ) )
+				_edges.emplace_back( i, j );
+}
+
+void ColoringBuilder::declare_variables()
+{
+	create_n_variables( _vertices, 0, _colors );
+}
+
+void ColoringBuilder::declare_constraints()
+{
+	constraints.emplace_back( std::make_shared<NotEqualNetwork>( variables, _edges ) );
+}
+
+/************
+ * Knapsack *
+ ************/
+KnapsackBuilder::KnapsackBuilder( int items )
+	: ModelBuilder()
+{
+	if( items == 5 )
+	{
+		_max_copies = 16;
+		_capacity = 15;
+		_weights = { 12, 2, 1, 1, 4 };
+		_values = { 4, 2, 2, 1, 10 };
+	}
+	else
+	{
+		std::mt19937 rng( instance_seed );
+		std::uniform_int_distribution<int> draw( 1, 30 );
+
+		_max_copies = 3;
+		for( int i = 0 ; i < items ; ++i )
+		{
+			_weights.push_back( draw( rng ) );
+			_values.push_back( draw( rng ) );
+		}
+
+		// Room for about a quarter of all copies of all items
+		_capacity = _max_copies * std::accumulate( _weights.begin(), _weights.end(), 0.0 ) / 4;
+	}
+}
+
+void KnapsackBuilder::declare_variables()
+{
+	create_n_variables( static_cast<int>( _weights.size() ), 0, _max_copies + 1 );
+}
+
+void KnapsackBuilder::declare_constraints()
+{
+	constraints.emplace_back( std::make_shared<LinearEquationLeq>( variables, _capacity, _weights ) );
+}
+
+void KnapsackBuilder::declare_objective()
+{
+	objective = std::make_shared<LinearObjective<ghost::Maximize>>( variables, _values, "Value" );
+}
+
+/************
+ * Job-shop *
+ ************/
+JobShopBuilder::JobShopBuilder( int jobs, int machines )
+	: ModelBuilder(),
+	  _jobs( jobs ),
+	  _machines( machines )
+{
+	if( jobs == 0 )
+	{
+		_jobs = 6;
+		_machines = 6;
+		_operations = { { {2,1}, {0,3}, {1,6}, {3,7}, {5,3}, {4,6} },
+		                { {1,8}, {2,5}, {4,10}, {5,10}, {0,10}, {3,4} },
+		                { {2,5}, {3,4}, {5,8}, {0,9}, {1,1}, {4,7} },
+		                { {1,5}, {0,5}, {2,5}, {3,3}, {4,8}, {5,9} },
+		                { {2,9}, {1,3}, {4,5}, {5,4}, {0,3}, {3,1} },
+		                { {1,3}, {3,3}, {5,9}, {0,10}, {4,4}, {2,1} } };
+	}
+	else
+	{
+		std::mt19937 rng( instance_seed );
+		std::uniform_int_distribution<int> duration( 1, 20 );
+
+		std::vector<int> order( machines );
+		std::iota( order.begin(), order.end(), 0 );
+
+		_operations.resize( jobs );
+		for( auto& job : _operations )
+		{
+			std::shuffle( order.begin(), order.end(), rng );
+			for( int machine : order )
+				job.emplace_back( machine, duration( rng ) );
+		}
+	}
+
+	// Running all operations one after the other is always possible
+	_horizon = 0;
+	for( const auto& job : _operations )
+		for( const auto& operation : job )
+			_horizon += operation.second;
+}
+
+void JobShopBuilder::declare_variables()
+{
+	create_n_variables( _jobs * _machines, 0, _horizon + 1 );
+}
+
+void JobShopBuilder::declare_constraints()
+{
+	std::vector<std::vector<int>> machine_operations( _machines );
+	std::vector<std::vector<int>> machine_durations( _machines );
+
+	for( int job = 0 ; job < _jobs ; ++job )
+		for( int rank = 0 ; rank < _machines ; ++rank )
+		{
+			int operation = job * _machines + rank;
+			auto [machine, duration] = _operations[ job ][ rank ];
+
+			machine_operations[ machine ].push_back( operation );
+			machine_durations[ machine ].push_back( duration );
+
+			// start[ operation ] + duration <= start[ operation + 1 ]
+			if( rank + 1 < _machines )
+				constraints.emplace_back( std::make_shared<LinearEquationLeq>( std::vector<int>{ operation, operation + 1 },
+				                                                               -duration,
+				                                                               std::vector<double>{ 1, -1 } ) );
+		}
+
+	for( int machine = 0 ; machine < _machines ; ++machine )
+		constraints.emplace_back( std::make_shared<NoOverlap>( machine_operations[ machine ], machine_durations[ machine ] ) );
+}
+
+void JobShopBuilder::declare_objective()
+{
+	std::vector<ghost::Variable> last_operations;
+	std::vector<double> durations;
+
+	for( int job = 0 ; job < _jobs ; ++job )
+	{
+		last_operations.push_back( variables[ job * _machines + _machines - 1 ] );
+		durations.push_back( _operations[ job ].back().second );
+	}
+
+	objective = std::make_shared<MinimizeMax>( last_operations, std::vector<double>( _jobs, 1.0 ), durations, "Makespan" );
+}
+
+/**********
+ * Sudoku *
+ **********/
+SudokuBuilder::SudokuBuilder( int order, double given_ratio )
+	: ModelBuilder(),
+	  _order( order )
+{
+	std::mt19937 rng( instance_seed );
+	std::bernoulli_distribution is_given( given_ratio );
+
+	int size = order * order;
+	std::vector<int> digits( size );
+	std::iota( digits.begin(), digits.end(), 1 );
+	std::shuffle( digits.begin(), digits.end(), rng );
+
+	// Relabelled canonical grid: shifting each row by the order, and each band by one more
+	_givens.resize( size * size );
+	for( int row = 0 ; row < size ; ++row )
+		for( int column = 0 ; column < size ; ++column )
+			_givens[ row * size + column ] = is_given( rng ) ? digits[ ( row * order + row / order + column ) % size ] : 0;
+}
+
+void SudokuBuilder::declare_variables()
+{
+	int size = _order * _order;
+
+	for( int given : _givens )
+		if( given == 0 )
+			variables.emplace_back( 1, size );
+		else
+			variables.emplace_back( std::vector<int>{ given } );
+}
+
+void SudokuBuilder::declare_constraints()
+{
+	int size = _order * _order;
+
+	for( int i = 0 ; i < size ; ++i )
+	{
+		std::vector<int> row;
+		std::vector<int> column;
+		std::vector<int> block;
+
+		for( int j = 0 ; j < size ; ++j )
+		{
+			row.push_back( i * size + j );
+			column.push_back( j * size + i );
+			block.push_back( ( ( i / _order ) * _order + j / _order ) * size + ( i % _order ) * _order + j % _order );
+		}
+
+		constraints.emplace_back( std::make_shared<AllDifferent>( row ) );
+		constraints.emplace_back( std::make_shared<AllDifferent>( column ) );
+		constraints.emplace_back( std::make_shared<AllDifferent>( block ) );
+	}
+}
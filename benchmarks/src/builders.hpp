@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include <ghost/model_builder.hpp>
+
+/*
+ * Model builders of the benchmark instances. Random instances are generated in the constructors
+ * from a fixed instance seed, so that every run of a given instance solves the same problem,
+ * whatever the seed of the solver.
+ */
+
+// N-Queens as a permutation problem: the queen of row i is in column variables[i].
+class QueensBuilder : public ghost::ModelBuilder
+{
+	int _size;
+
+public:
+	QueensBuilder( int size );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+};
+
+// Magic square of order n as a permutation of 1..n^2, where each row, column and diagonal sums to n(n^2+1)/2.
+class MagicSquareBuilder : public ghost::ModelBuilder
+{
+	int _order;
+
+public:
+	MagicSquareBuilder( int order );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+};
+
+// Golomb ruler with a given number of marks, whose length is the optimal one.
+class GolombBuilder : public ghost::ModelBuilder
+{
+	int _marks;
+	int _length;
+
+public:
+	GolombBuilder( int marks );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+};
+
+// Graph colouring of a random graph with a planted k-colouring, so that instances are satisfiable.
+class ColoringBuilder : public ghost::ModelBuilder
+{
+	int _vertices;
+	int _colors;
+	std::vector<std::pair<int, int>> _edges;
+
+public:
+	ColoringBuilder( int vertices, int colors, double density );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+};
+
+// Bounded knapsack maximizing the value of the selected items. 5 items is the instance of tutorial/video.
+class KnapsackBuilder : public ghost::ModelBuilder
+{
+	int _max_copies;
+	double _capacity;
+	std::vector<double> _weights;
+	std::vector<double> _values;
+
+public:
+	KnapsackBuilder( int items );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+	void declare_objective() override;
+};
+
+// Job-shop minimizing the makespan, where variables are start times of operations, job by job.
+// 0 jobs is the ft06 instance of Fisher and Thompson (optimal makespan: 55), otherwise a random instance.
+class JobShopBuilder : public ghost::ModelBuilder
+{
+	int _jobs;
+	int _machines;
+	int _horizon;
+	// _operations[ job ][ rank ] is the (machine, duration) pair of an operation.
+	std::vector<std::vector<std::pair<int, int>>> _operations;
+
+public:
+	JobShopBuilder( int jobs = 0, int machines = 0 );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+	void declare_objective() override;
+};
+
+// Sudoku of order n, i.e., a n^2 x n^2 grid, with a part of the cells given.
+class SudokuBuilder : public ghost::ModelBuilder
+{
+	int _order;
+	// _givens[ cell ] is the value of the cell, or 0 if it is free.
+	std::vector<int> _givens;
+
+public:
+	SudokuBuilder( int order, double given_ratio );
+
+	void declare_variables() override;
+	void declare_constraints() override;
+};
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cstdlib>
+
+#include "constraints.hpp"
+
+QueensDiagonals::QueensDiagonals( const std::vector<ghost::Variable>& variables )
+	: Constraint( variables ),
+	  _size( static_cast<int>( variables.size() ) ),
+	  _up( 2 * _size - 1, 0 ),
+	  _down( 2 * _size - 1, 0 )
+{ }
+
+// Like AllDifferent, a queen joining a diagonal with c queens adds c attacking pairs.
+double QueensDiagonals::move( int row, int from, int to ) const
+{
+	double diff = 0.0;
+
+	diff -= --_up[ from + row ];
+	diff -= --_down[ from - row + _size - 1 ];
+	diff += _up[ to + row ]++;
+	diff += _down[ to - row + _size - 1 ]++;
+
+	return diff;
+}
+
+double QueensDiagonals::required_error( const std::vector<ghost::Variable*>& variables ) const
+{
+	double error = 0.0;
+
+	std::fill( _up.begin(), _up.end(), 0 );
+	std::fill( _down.begin(), _down.end(), 0 );
+
+	for( int row = 0 ; row < _size ; ++row )
+	{
+		int value = variables[ row ]->get_value();
+		error += _up[ value + row ]++;
+		error += _down[ value - row + _size - 1 ]++;
+	}
+
+	return error;
+}
+
+double QueensDiagonals::optional_delta_error( const std::vector<ghost::Variable*>& variables,
+                                              const std::vector<int>& variable_indexes,
+                                              const std::vector<int>& candidate_values ) const
+{
+	double diff = 0.0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		diff += move( variable_indexes[ i ], variables[ variable_indexes[ i ] ]->get_value(), candidate_values[ i ] );
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+		move( variable_indexes[ i ], candidate_values[ i ], variables[ variable_indexes[ i ] ]->get_value() );
+
+	return diff;
+}
+
+void QueensDiagonals::conditional_update_data_structures( const std::vector<ghost::Variable*>& variables, int variable_index, int new_value )
+{
+	move( variable_index, variables[ variable_index ]->get_value(), new_value );
+}
+
+GolombRuler::GolombRuler( const std::vector<ghost::Variable>& variables, int length )
+	: Constraint( variables ),
+	  _count( length + 1, 0 ),
+	  _values( variables.size(), 0 )
+{ }
+
+// Two marks at the same place always conflict. Otherwise, a pair joining c pairs at the same distance adds c conflicts.
+double GolombRuler::add_pair( int distance ) const
+{
+	if( distance == 0 )
+	{
+		++_count[ 0 ];
+		return 1.0;
+	}
+
+	return _count[ distance ]++;
+}
+
+double GolombRuler::remove_pair( int distance ) const
+{
+	if( distance == 0 )
+	{
+		--_count[ 0 ];
+		return 1.0;
+	}
+
+	return --_count[ distance ];
+}
+
+double GolombRuler::move( int index, int to ) const
+{
+	double diff = 0.0;
+
+	for( int j = 0 ; j < static_cast<int>( _values.size() ) ; ++j )
+		if( j != index )
+			diff -= remove_pair( std::abs( _values[ index ] - _values[ j ] ) );
+
+	_values[ index ] = to;
+
+	for( int j = 0 ; j < static_cast<int>( _values.size() ) ; ++j )
+		if( j != index )
+			diff += add_pair( std::abs( to - _values[ j ] ) );
+
+	return diff;
+}
+
+double GolombRuler::required_error( const std::vector<ghost::Variable*>& variables ) const
+{
+	double error = 0.0;
+
+	std::fill( _count.begin(), _count.end(), 0 );
+
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+	{
+		_values[ i ] = variables[ i ]->get_value();
+		for( int j = 0 ; j < i ; ++j )
+			error += add_pair( std::abs( _values[ i ] - _values[ j ] ) );
+	}
+
+	return error;
+}
+
+double GolombRuler::optional_delta_error( const std::vector<ghost::Variable*>& variables,
+                                          const std::vector<int>& variable_indexes,
+                                          const std::vector<int>& candidate_values ) const
+{
+	double diff = 0.0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		diff += move( variable_indexes[ i ], candidate_values[ i ] );
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+		move( variable_indexes[ i ], variables[ variable_indexes[ i ] ]->get_value() );
+
+	return diff;
+}
+
+void GolombRuler::conditional_update_data_structures( const std::vector<ghost::Variable*>& variables, int variable_index, int new_value )
+{
+	move( variable_index, new_value );
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include <ghost/constraint.hpp>
+#include <ghost/variable.hpp>
+
+/*
+ * No two queens on the same diagonal, where variables[i] is the column of the queen on row i.
+ * Rows and columns are handled by the permutation: this is the N-Queens model with swaps only.
+ * The error is the number of pairs of queens attacking each other on a diagonal.
+ */
+class QueensDiagonals : public ghost::Constraint
+{
+	int _size;
+
+	// Number of queens on each diagonal, indexed by value + row and value - row + size - 1.
+	mutable std::vector<int> _up;
+	mutable std::vector<int> _down;
+
+	double move( int row, int from, int to ) const;
+
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override;
+
+	double optional_delta_error( const std::vector<ghost::Variable*>& variables,
+	                             const std::vector<int>& variable_indexes,
+	                             const std::vector<int>& candidate_values ) const override;
+
+	void conditional_update_data_structures( const std::vector<ghost::Variable*>& variables,
+	                                         int variable_index,
+	                                         int new_value ) override;
+
+public:
+	QueensDiagonals( const std::vector<ghost::Variable>& variables );
+};
+
+/*
+ * All marks of a Golomb ruler are distinct, and so are the distances between each pair of marks.
+ * The error is the number of pairs of marks at the same place, plus the number of pairs of pairs
+ * of marks measuring the same distance.
+ */
+class GolombRuler : public ghost::Constraint
+{
+	// _count[d] is the number of pairs of marks at distance d.
+	mutable std::vector<int> _count;
+	mutable std::vector<int> _values;
+
+	double add_pair( int distance ) const;
+	double remove_pair( int distance ) const;
+	double move( int index, int to ) const;
+
+	double required_error( const std::vector<ghost::Variable*>& variables ) const override;
+
+	double optional_delta_error( const std::vector<ghost::Variable*>& variables,
+	                             const std::vector<int>& variable_indexes,
+	                             const std::vector<int>& candidate_values ) const override;
+
+	void conditional_update_data_structures( const std::vector<ghost::Variable*>& variables,
+	                                         int variable_index,
+	                                         int new_value ) override;
+
+public:
+	GolombRuler( const std::vector<ghost::Variable>& variables, int length );
+};
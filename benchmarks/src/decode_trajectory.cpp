@@ -0,0 +1,70 @@
+#include <iostream>
+#include <string>
+
+#include <ghost/trajectory_recorder.hpp>
+
+/*
+ * Decoder of trajectory files written by GHOST when compiled with GHOST_RECORD.
+ * Events are printed in file order on the standard output, either as text lines close to GHOST_TRACE
+ * outputs or as CSV. Use --unit to keep the events of a single search unit, in chronological order.
+ */
+
+void usage( const char* program )
+{
+	std::cerr << "Usage: " << program << " FILE [options]\n"
+	          << "  --format text|csv      output format (default: text)\n"
+	          << "  --unit U               only print events of the search unit U (default: all units)\n";
+}
+
+int main( int argc, char** argv )
+{
+	if( argc < 2 )
+	{
+		usage( argv[0] );
+		return 1;
+	}
+
+	std::string filename = argv[1];
+	std::string format = "text";
+	int unit = -1;
+
+	for( int i = 2 ; i < argc ; ++i )
+	{
+		std::string argument = argv[ i ];
+		if( i + 1 >= argc || ( argument != "--format" && argument != "--unit" ) )
+		{
+			usage( argv[0] );
+			return 1;
+		}
+
+		if( argument == "--format" )
+			format = argv[ ++i ];
+		else
+			unit = std::stoi( argv[ ++i ] );
+	}
+
+	if( format != "text" && format != "csv" )
+	{
+		usage( argv[0] );
+		return 1;
+	}
+
+	try
+	{
+		auto events = ghost::TrajectoryRecorder::read( filename );
+
+		if( format == "csv" )
+			std::cout << ghost::TrajectoryEvent::csv_header() << "\n";
+
+		for( const auto& event : events )
+			if( unit < 0 || event.unit == unit )
+				std::cout << ( format == "csv" ? event.to_csv() : event.to_text() ) << "\n";
+	}
+	catch( const std::exception& e )
+	{
+		std::cerr << e.what();
+		return 1;
+	}
+
+	return 0;
+}
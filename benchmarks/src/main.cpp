@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ghost/solver.hpp>
+
+#include "builders.hpp"
+
+/*
+ * Benchmark suite of GHOST, running fast_search on canonical CSP and COP instances.
+ *
+ * Each run is seeded: repetition r of an instance uses the solver seed 'seed + r', so two runs with the same
+ * seed follow the same search trajectory (up to the timeout, and in sequential mode only).
+ * The search algorithm is chosen at compile time, see the ghost_bench_random_walk and ghost_bench_hill_climbing targets.
+ *
+ * Results are written on the standard output, either as CSV (one line per run) or as JSON (runs, plus
+ * time-to-solution and cost distributions per instance). Optimization runs always use their full time budget,
+ * so their final costs are the numbers to compare.
+ *
+ * If GHOST_PROFILE is defined (cmake -DPROFILE=ON), the time spent in each phase of the search is printed
+ * on the standard error for each instance, summed over its runs.
+ *
+ * ghost_bench_record records the trajectory of each run with GHOST_RECORD, to measure its overhead against
+ * ghost_bench. Each run overwrites the trajectory file, see --trajectory and ghost_decode_trajectory.
+ */
+
+#if defined GHOST_RANDOM_WALK
+constexpr char mode[] = "random_walk";
+#elif defined GHOST_HILL_CLIMBING
+constexpr char mode[] = "hill_climbing";
+#elif defined GHOST_RECORD
+constexpr char mode[] = "record";
+#else
+constexpr char mode[] = "default";
+#endif
+
+struct Run
+{
+	std::string instance;
+	bool is_optimization;
+	int repetition;
+	int seed;
+	bool solved;
+	double cost;
+	ghost::SolverStatistics statistics;
+	ghost::SearchProfile profile;
+};
+
+struct Instance
+{
+	std::string name;
+	bool is_optimization;
+	std::function<void( Run&, double, ghost::Options& )> run;
+};
+
+template<typename Builder, typename ... Args>
+Instance make_instance( const std::string& name, bool is_optimization, Args ... args )
+{
+	return Instance{ name,
+	                 is_optimization,
+	                 [=]( Run& run, double timeout, ghost::Options& options )
+	                 {
+		                 Builder builder( args... );
+		                 ghost::Solver<Builder> solver( builder );
+		                 std::vector<int> solution;
+		                 run.solved = solver.fast_search( run.cost, solution, timeout, options );
+		                 run.statistics = solver.get_statistics();
+		                 run.profile = solver.get_search_profile();
+	                 } };
+}
+
+std::vector<Instance> all_instances()
+{
+	return { make_instance<QueensBuilder>( "queens-8", false, 8 ),
+	         make_instance<QueensBuilder>( "queens-100", false, 100 ),
+	         make_instance<QueensBuilder>( "queens-1000", false, 1000 ),
+	         make_instance<MagicSquareBuilder>( "magic-square-3", false, 3 ),
+	         make_instance<MagicSquareBuilder>( "magic-square-5", false, 5 ),
+	         make_instance<MagicSquareBuilder>( "magic-square-8", false, 8 ),
+	         make_instance<GolombBuilder>( "golomb-5", false, 5 ),
+	         make_instance<GolombBuilder>( "golomb-7", false, 7 ),
+	         make_instance<GolombBuilder>( "golomb-9", false, 9 ),
+	         make_instance<ColoringBuilder>( "coloring-50-4", false, 50, 4, 0.2 ),
+	         make_instance<ColoringBuilder>( "coloring-200-8", false, 200, 8, 0.1 ),
+	         make_instance<KnapsackBuilder>( "knapsack-5", true, 5 ),
+	         make_instance<KnapsackBuilder>( "knapsack-50", true, 50 ),
+	         make_instance<KnapsackBuilder>( "knapsack-200", true, 200 ),
+	         make_instance<JobShopBuilder>( "jobshop-ft06", true, 0, 0 ),
+	         make_instance<JobShopBuilder>( "jobshop-10x5", true, 10, 5 ),
+	         make_instance<SudokuBuilder>( "sudoku-9", false, 3, 0.5 ),
+	         make_instance<SudokuBuilder>( "sudoku-16", false, 4, 0.5 ),
+	         make_instance<SudokuBuilder>( "sudoku-25", false, 5, 0.5 ) };
+}
+
+// Quantile of sorted values, with linear interpolation.
+double quantile( const std::vector<double>& sorted_values, double q )
+{
+	if( sorted_values.empty() )
+		return 0.0;
+
+	double position = q * ( sorted_values.size() - 1 );
+	int index = static_cast<int>( position );
+	if( index + 1 >= static_cast<int>( sorted_values.size() ) )
+		return sorted_values.back();
+
+	return sorted_values[ index ] + ( position - index ) * ( sorted_values[ index + 1 ] - sorted_values[ index ] );
+}
+
+void print_distribution( std::ostream& os, std::vector<double> values )
+{
+	std::sort( values.begin(), values.end() );
+	os << "{\"count\": " << values.size();
+	if( !values.empty() )
+	{
+		double sum = 0.0;
+		for( auto value : values )
+			sum += value;
+
+		os << ", \"min\": " << values.front()
+		   << ", \"median\": " << quantile( values, 0.5 )
+		   << ", \"mean\": " << sum / values.size()
+		   << ", \"p90\": " << quantile( values, 0.9 )
+		   << ", \"max\": " << values.back();
+	}
+	os << "}";
+}
+
+void print_csv( std::ostream& os, const std::vector<Run>& runs )
+{
+	os << "mode,instance,type,repetition,seed,solved,cost,search_time_us,wall_clock_time_us,search_iterations,local_moves,plateau_moves,resets,restarts,moves_per_second\n";
+	for( const auto& run : runs )
+		os << mode << ","
+		   << run.instance << ","
+		   << ( run.is_optimization ? "cop" : "csp" ) << ","
+		   << run.repetition << ","
+		   << run.seed << ","
+		   << run.solved << ","
+		   << run.cost << ","
+		   << run.statistics.search_time << ","
+		   << run.statistics.wall_clock_time << ","
+		   << run.statistics.winning_unit.search_iterations << ","
+		   << run.statistics.winning_unit.local_moves << ","
+		   << run.statistics.winning_unit.plateau_moves << ","
+		   << run.statistics.winning_unit.resets << ","
+		   << run.statistics.winning_unit.restarts << ","
+		   << run.statistics.moves_per_second << "\n";
+}
+
+void print_json( std::ostream& os, const std::vector<Run>& runs, const std::vector<std::string>& instances, double timeout )
+{
+	os << "{\n  \"mode\": \"" << mode << "\",\n  \"timeout_us\": " << timeout << ",\n  \"runs\": [\n";
+	for( int i = 0 ; i < static_cast<int>( runs.size() ) ; ++i )
+	{
+		const auto& run = runs[ i ];
+		os << "    {\"instance\": \"" << run.instance << "\""
+		   << ", \"type\": \"" << ( run.is_optimization ? "cop" : "csp" ) << "\""
+		   << ", \"repetition\": " << run.repetition
+		   << ", \"seed\": " << run.seed
+		   << ", \"solved\": " << std::boolalpha << run.solved
+		   << ", \"cost\": " << run.cost
+		   << ", \"search_time_us\": " << run.statistics.search_time
+		   << ", \"wall_clock_time_us\": " << run.statistics.wall_clock_time
+		   << ", \"search_iterations\": " << run.statistics.winning_unit.search_iterations
+		   << ", \"local_moves\": " << run.statistics.winning_unit.local_moves
+		   << ", \"plateau_moves\": " << run.statistics.winning_unit.plateau_moves
+		   << ", \"resets\": " << run.statistics.winning_unit.resets
+		   << ", \"restarts\": " << run.statistics.winning_unit.restarts
+		   << ", \"moves_per_second\": " << run.statistics.moves_per_second << "}"
+		   << ( i + 1 < static_cast<int>( runs.size() ) ? ",\n" : "\n" );
+	}
+
+	os << "  ],\n  \"summary\": [\n";
+	for( int i = 0 ; i < static_cast<int>( instances.size() ) ; ++i )
+	{
+		std::vector<double> times_to_solution;
+		std::vector<double> costs;
+		std::vector<double> moves_per_second;
+		int number_runs = 0;
+
+		for( const auto& run : runs )
+			if( run.instance == instances[ i ] )
+			{
+				++number_runs;
+				moves_per_second.push_back( run.statistics.moves_per_second );
+				if( run.solved )
+				{
+					times_to_solution.push_back( run.statistics.search_time );
+					costs.push_back( run.cost );
+				}
+			}
+
+		os << "    {\"instance\": \"" << instances[ i ] << "\""
+		   << ", \"runs\": " << number_runs
+		   << ", \"solved\": " << times_to_solution.size()
+		   << ", \"time_to_solution_us\": ";
+		print_distribution( os, times_to_solution );
+		os << ", \"cost\": ";
+		print_distribution( os, costs );
+		os << ", \"moves_per_second\": ";
+		print_distribution( os, moves_per_second );
+		os << "}" << ( i + 1 < static_cast<int>( instances.size() ) ? ",\n" : "\n" );
+	}
+	os << "  ]\n}\n";
+}
+
+void usage( const char* program )
+{
+	std::cerr << "Usage: " << program << " [options]\n"
+	          << "  --list                 print the names of all instances and exit\n"
+	          << "  --instance NAME        run the instance NAME, or all instances of the family NAME like 'queens' (repeatable, all instances by default)\n"
+	          << "  --repetitions R        number of runs per instance (default: 5)\n"
+	          << "  --seed S               solver seed of the first repetition, incremented at each repetition (default: 1)\n"
+	          << "  --timeout MS           time budget per run, in milliseconds (default: 1000)\n"
+	          << "  --threads T            number of threads, parallel runs if greater than 1 (default: 1)\n"
+	          << "  --format csv|json      output format (default: csv)\n"
+	          << "  --trajectory FILE      trajectory file of ghost_bench_record (default: ghost_trajectory.bin)\n";
+}
+
+int main( int argc, char** argv )
+{
+	std::vector<std::string> selection;
+	int repetitions = 5;
+	int seed = 1;
+	double timeout_ms = 1000;
+	int threads = 1;
+	std::string format = "csv";
+	std::string trajectory_file = "ghost_trajectory.bin";
+	bool list = false;
+
+	std::map<std::string, std::function<void( const std::string& )>> parsers{
+		{ "--instance", [&]( const std::string& value ){ selection.push_back( value ); } },
+		{ "--repetitions", [&]( const std::string& value ){ repetitions = std::stoi( value ); } },
+		{ "--seed", [&]( const std::string& value ){ seed = std::stoi( value ); } },
+		{ "--timeout", [&]( const std::string& value ){ timeout_ms = std::stod( value ); } },
+		{ "--threads", [&]( const std::string& value ){ threads = std::stoi( value ); } },
+		{ "--format", [&]( const std::string& value ){ format = value; } },
+		{ "--trajectory", [&]( const std::string& value ){ trajectory_file = value; } } };
+
+	for( int i = 1 ; i < argc ; ++i )
+	{
+		std::string argument = argv[ i ];
+
+		if( argument == "--list" )
+		{
+			list = true;
+			continue;
+		}
+
+		auto parser = parsers.find( argument );
+		if( parser == parsers.end() || i + 1 >= argc )
+		{
+			usage( argv[0] );
+			return 1;
+		}
+
+		parser->second( argv[ ++i ] );
+	}
+
+	if( format != "csv" && format != "json" )
+	{
+		usage( argv[0] );
+		return 1;
+	}
+
+	std::vector<Instance> instances;
+	for( auto& instance : all_instances() )
+		if( selection.empty() || std::any_of( selection.begin(), selection.end(), [&]( const auto& name ){ return instance.name == name || instance.name.rfind( name + "-", 0 ) == 0; } ) )
+			instances.push_back( std::move( instance ) );
+
+	if( list )
+	{
+		for( const auto& instance : instances )
+			std::cout << instance.name << "\n";
+		return 0;
+	}
+
+	double timeout = timeout_ms * 1000;
+	std::vector<Run> runs;
+	std::vector<std::string> names;
+
+	for( auto& instance : instances )
+	{
+		names.push_back( instance.name );
+		for( int repetition = 0 ; repetition < repetitions ; ++repetition )
+		{
+			ghost::Options options;
+			options.seed = seed + repetition;
+			options.parallel_runs = threads > 1;
+			options.number_threads = threads;
+			options.trajectory_file = trajectory_file;
+
+			Run run{ instance.name, instance.is_optimization, repetition, seed + repetition, false, 0.0, ghost::SolverStatistics(), ghost::SearchProfile() };
+			instance.run( run, timeout, options );
+			runs.push_back( run );
+		}
+
+#if defined GHOST_PROFILE
+		ghost::SearchProfile profile;
+		for( const auto& run : runs )
+			if( run.instance == instance.name )
+				profile += run.profile;
+		std::cerr << "== " << instance.name << "\n" << profile << "\n";
+#endif
+	}
+
+	std::cout << std::setprecision( 10 );
+	if( format == "csv" )
+		print_csv( std::cout, runs );
+	else
+		print_json( std::cout, runs, names, timeout );
+}
@@ -24,7 +24,7 @@ fi
 
 function usage()
 {
-    echo "$0: usage: build.sh [release|rel_dbg_info|debug|debug_no_asan|android|clean|doc|tests|tutorial]"
+    echo "$0: usage: build.sh [release|rel_dbg_info|debug|debug_no_asan|android|clean|doc|tests|tutorial|bench]"
     exit 1
 }
 
@@ -145,6 +145,12 @@ function clean()
 				make clean
 				sudo rm -fr *
 				cd $BACKPWD
+    fi
+		if [ -d "benchmarks/build" ]; then 
+				cd benchmarks/build/
+				make clean
+				sudo rm -fr *
+				cd $BACKPWD
     fi
 		if [ -d "tutorial/wiki/build" ]; then 
 				cd tutorial/wiki/build/
@@ -194,6 +200,15 @@ function tests()
     make
 }
 
+function bench()
+{
+    cd benchmarks
+    mkdir -p build
+    cd build
+    cmake ..
+    make
+}
+
 function tutorial()
 {
     cd tutorial
@@ -269,6 +284,10 @@ elif [ "$1" == "tutorial" ]; then
     tutorial
     cd $BACKPWD
     exit 0
+elif [ "$1" == "bench" ]; then
+    bench
+    cd $BACKPWD
+    exit 0
 else
     usage
 fi
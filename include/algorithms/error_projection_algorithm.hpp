@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <memory>
+#include <utility>
 
 #include "../search_unit_data.hpp"
 #include "../constraint.hpp"
@@ -49,6 +50,20 @@ namespace ghost
 			// Protected string variable for the heuristic name. Used for debug/trace purposes.
 			std::string name;
 
+			// Buffer for changes of projected errors given by constraints, as couples (variable id, error change).
+			std::vector<std::pair<int, double>> error_changes;
+
+			// Add to data.error_variables errors of constraints projecting their error by themselves,
+			// i.e., overriding Constraint::optional_variable_error.
+			void compute_projected_variable_errors( const std::vector<std::shared_ptr<Constraint>>& constraints,
+			                                        SearchUnitData& data )
+			{
+				for( auto constraint : constraints )
+					if( constraint->is_optional_variable_error_defined() )
+						for( const int variable_id : constraint->_variables_index )
+							data.error_variables[ variable_id ] += constraint->variable_error( variable_id );
+			}
+
 		public:
 			ErrorProjection( std::string&& name )
 				: name( std::move( name ) )
@@ -73,6 +88,18 @@ namespace ghost
 			                                     std::shared_ptr<Constraint> constraint,
 			                                     SearchUnitData& data,
 			                                     double delta ) = 0;
+
+			// Incremental update of data.error_variables for constraints projecting their error by themselves,
+			// before variable_id takes new_value.
+			virtual void update_projected_variable_errors( std::shared_ptr<Constraint> constraint,
+			                                               SearchUnitData& data,
+			                                               int variable_id,
+			                                               int new_value )
+			{
+				constraint->variable_error_changes( variable_id, new_value, error_changes );
+				for( const auto& change : error_changes )
+					data.error_variables[ change.first ] += change.second;
+			}
 		};
 	}
 }
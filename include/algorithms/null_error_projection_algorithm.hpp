@@ -48,6 +48,11 @@ namespace ghost
 			                             std::shared_ptr<Constraint> constraint,
 			                             SearchUnitData& data,
 			                             double delta ) override;
+
+			void update_projected_variable_errors( std::shared_ptr<Constraint> constraint,
+			                                       SearchUnitData& data,
+			                                       int variable_id,
+			                                       int new_value ) override;
 		};
 	}
 }
@@ -46,6 +46,7 @@ namespace ghost
 {
 	namespace algorithms
 	{
+		class ErrorProjection;
 		class AdaptiveSearchErrorProjection;
 		class CulpritSearchErrorProjection;
 	}
@@ -62,8 +63,10 @@ namespace ghost
 	class Constraint
 	{
 		friend class SearchUnit;
+		friend struct SearchUnitData;
 		template<typename ModelBuilderType> friend class Solver;
 		friend class ModelBuilder;
+		friend class algorithms::ErrorProjection;
 		friend class algorithms::AdaptiveSearchErrorProjection;
 		friend class algorithms::CulpritSearchErrorProjection;
 
@@ -75,6 +78,8 @@ namespace ghost
 
 		int _id; // Unique ID integer
 		mutable bool _is_optional_delta_error_defined; // Boolean telling if optional_delta_error() is overrided or not.
+		mutable bool _is_optional_filter_domains_defined; // Boolean telling if optional_filter_domains() is overrided or not.
+		mutable bool _is_optional_variable_error_defined; // Boolean telling if optional_variable_error() is overrided or not.
 
 		struct nanException : std::exception
 		{
@@ -129,6 +134,28 @@ namespace ghost
 			const char* what() const noexcept { return message.c_str(); }
 		};
 
+		struct filterDomainsNotDefinedException : std::exception
+		{
+			std::string message;
+
+			filterDomainsNotDefinedException()
+			{
+				message = "Constraint::optional_filter_domains() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		struct variableErrorNotDefinedException : std::exception
+		{
+			std::string message;
+
+			variableErrorNotDefinedException()
+			{
+				message = "Constraint::optional_variable_error() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
 		struct variableOutOfTheScope : std::exception
 		{
 			std::string message;
@@ -141,6 +168,8 @@ namespace ghost
 		};
 
 		inline bool is_optional_delta_error_defined() { return _is_optional_delta_error_defined; }
+		inline bool is_optional_filter_domains_defined() { return _is_optional_filter_domains_defined; }
+		inline bool is_optional_variable_error_defined() { return _is_optional_variable_error_defined; }
 
 		// Call required_error() after getting sure the error does give a nan, rise an exception otherwise.
 		double error() const;
@@ -154,6 +183,16 @@ namespace ghost
 		// This calls delta_error() if the user overrided it, otherwise it makes the simulation 'by hand' and calls error()
 		double simulate_delta( const std::vector<int>& variables_index, const std::vector<int>& candidate_values );
 
+		// Filter the domains of the constraint's variables, given in the same order than _variables.
+		// Calling optional_filter_domains if the user overrided it. Return false iff a domain has been emptied.
+		bool filter_domains( std::vector<std::vector<int>>& domains ) const;
+
+		// Calling optional_variable_error after making the conversion of the variable index.
+		inline double variable_error( int variable_id ) const { return optional_variable_error( _variables, _variables_position.at( variable_id ) ); }
+
+		// Calling optional_variable_error_changes after making the conversion of the variable index. Changes are given with variable ids.
+		void variable_error_changes( int variable_id, int new_value, std::vector<std::pair<int, double>>& error_changes ) const;
+
 		// Return ids of variable objects in _variables.
 		inline std::vector<int> get_variable_ids() const { return _variables_index; }
 
@@ -257,6 +296,93 @@ namespace ghost
 		 */
 		virtual void conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value );
 
+		/*!
+		 * Virtual method to filter the domains of the variables in the scope of the constraint,
+		 * i.e., to remove values that cannot belong to any solution of the constraint.
+		 *
+		 * This method is only used by the complete solver (see Solver::complete_search). Without
+		 * it, the solver filters domains by enumerating all combinations of values of free variables
+		 * until finding a support, which is very costly for constraints with a large scope. Global
+		 * constraints are typically able to filter their domains much more efficiently, for instance
+		 * by reasoning on bounds.
+		 *
+		 * Domains are given in the same order than variables. Variables already assigned by the
+		 * solver have a singleton domain. Implementations can remain partial (it is fine to keep
+		 * some values without supports), but must respect these two rules:
+		 * - never remove a value belonging to a solution of the constraint, regarding the given domains.
+		 * - if all domains but one are singletons, remove from this domain all values violating the
+		 * constraint. If all domains are singletons and violate the constraint, empty one of them.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint. Their values must not be used, since they do not reflect the domains
+		 * to filter.
+		 * \param domains a reference to the vector of domains to filter, domains[i] being the current
+		 * domain of variables[i].
+		 */
+		virtual void optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const;
+
+		/*!
+		 * Virtual method to project the error of the constraint onto one of its variables, i.e.,
+		 * to compute how much this variable is responsible for the constraint error.
+		 *
+		 * By default, the solver projects constraint errors onto variables with an error projection
+		 * algorithm, which is either imprecise for constraints with a large scope (each variable
+		 * gets the whole constraint error), or costly (simulating several delta errors per variable).
+		 * Constraints decomposable into many small parts, like a network of binary constraints, can
+		 * instead directly give the error of each variable, like the number of violated parts
+		 * involving it. Projected errors do not need to sum up to the constraint error.
+		 *
+		 * This method is used together with optional_variable_error_changes, and both methods must
+		 * be overridden.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param index the index of the variable in 'variables' to compute the projected error.
+		 * \return A positive double corresponding to the error projected onto variables[index].
+		 */
+		virtual double optional_variable_error( const std::vector<Variable*>& variables, int index ) const;
+
+		/*!
+		 * Virtual method to compute the changes of projected errors (see optional_variable_error)
+		 * if variables[index] takes the value new_value. It is called by the solver before
+		 * conditional_update_data_structures, for each local move.
+		 *
+		 * Only variables whose projected error changes need to be given, such that a local move
+		 * does not cost a pass over the whole constraint scope.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory, but
+		 * it must be overridden if optional_variable_error is.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the constraint.
+		 * \param index the index of the variable in 'variables' that is reassigned.
+		 * \param new_value the new value of variables[index].
+		 * \param error_changes a reference to a vector to fill with couples (index in 'variables', change
+		 * of the projected error of this variable).
+		 */
+		virtual void optional_variable_error_changes( const std::vector<Variable*>& variables,
+		                                              int index,
+		                                              int new_value,
+		                                              std::vector<std::pair<int, double>>& error_changes ) const;
+
+		/*!
+		 * Virtual method telling if swapping the values of two variables in the scope of the
+		 * constraint never changes its error, like for an AllDifferent constraint.
+		 *
+		 * In permutation problems, a swap-invariant constraint whose scope contains all variables
+		 * that can be swapped has a constant error. The solver then never simulates its delta errors.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. By
+		 * default, constraints are not considered to be swap-invariant.
+		 *
+		 * \return True iff swapping the values of two variables in the scope cannot change the error.
+		 */
+		virtual bool optional_is_swap_invariant() const;
+
 		/*!
 		 * Inline method returning the current error of the constraint (automatically updated by the
 		 * solver). This can be helpful for implementing optional_delta_error.
@@ -327,6 +453,9 @@ namespace ghost
 			return 0.;
 		}
 
+		void optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+		{ }
+
 	public:
 		PureOptimization( const std::vector<Variable>& variables )
 			: Constraint( variables )
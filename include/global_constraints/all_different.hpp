@@ -30,7 +30,7 @@
 #pragma once
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include "../variable.hpp"
 #include "../constraint.hpp"
@@ -45,7 +45,17 @@ namespace ghost
 	 */
 		class AllDifferent : public Constraint
 		{
-			mutable std::map<int,int> _count;
+			// _count[ value - _offset ] is the number of variables in the scope taking the given value.
+			// The array is sized once from the domain bounds of the scope's variables. If these bounds span
+			// far more values than the domains contain, counts are kept in _sparse_count instead.
+			mutable std::vector<int> _count;
+			mutable std::unordered_map<int, int> _sparse_count;
+			mutable int _offset;
+			mutable bool _is_dense;
+			mutable bool _is_initialized;
+
+			void initialize_counts( const std::vector<Variable*>& variables ) const;
+			inline int& count( int value ) const { return _is_dense ? _count[ value - _offset ] : _sparse_count[ value ]; }
 			
 			double required_error( const std::vector<Variable*>& variables ) const override;
 			
@@ -57,7 +67,10 @@ namespace ghost
 			                                         int variable_index,
 			                                         int new_value ) override;
 
-			double binomial_with_2( int value ) const;
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
 
 		public:
 			/*!
@@ -30,7 +30,7 @@
 #pragma once
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include "../variable.hpp"
 #include "../constraint.hpp"
@@ -45,7 +45,23 @@ namespace ghost
 	 */
 		class AllEqual : public Constraint
 		{
-			mutable std::map<int,int> _count;
+			// _count[ value - _offset ] is the number of variables in the scope taking the given value, or
+			// _sparse_count[ value ] if domain bounds span far more values than the domains contain.
+			// _buckets[ f ] is the number of values taken by exactly f variables, and _max_count is the highest
+			// frequency, i.e., the largest f such that _buckets[ f ] > 0.
+			mutable std::vector<int> _count;
+			mutable std::unordered_map<int, int> _sparse_count;
+			mutable std::vector<int> _buckets;
+			mutable int _offset;
+			mutable int _max_count;
+			mutable bool _is_dense;
+			mutable bool _is_initialized;
+
+			void initialize_counts( const std::vector<Variable*>& variables ) const;
+			inline int& count( int value ) const { return _is_dense ? _count[ value - _offset ] : _sparse_count[ value ]; }
+
+			void increment( int value ) const;
+			void decrement( int value ) const;
 			
 			double required_error( const std::vector<Variable*>& variables ) const override;
 			
@@ -57,6 +73,11 @@ namespace ghost
 			                                         int variable_index,
 			                                         int new_value ) override;
 
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
+
 		public:
 			/*!
 			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
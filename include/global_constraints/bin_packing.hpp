@@ -0,0 +1,131 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+#include <utility>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the BinPacking constraint, where each variable gives the bin of an item with a given size,
+		 * such that the load of each bin does not exceed its capacity. Bins are numbered from 0.
+		 * See http://sofdem.github.io/gccat/gccat/Cbin_packing_capa.html
+		 *
+		 * The error is the total overflow of bins, an item in a non-existing bin overflowing by its whole size.
+		 * The error projected onto each item is the overflow of its bin, so that items in overloaded bins are favoured
+		 * by variable heuristics.
+		 *
+		 * Bin loads are kept in a flat array: the error delta of moving an item, or swapping two items, is computed in O(1).
+		 */
+		class BinPacking : public Constraint
+		{
+			std::vector<int> _sizes;
+			std::vector<int> _capacities;
+
+			mutable std::vector<int> _bins;
+			mutable std::vector<long long> _loads;
+
+			// Items in each bin, with the index of each item in the list of its bin, to project errors.
+			mutable std::vector<std::vector<int>> _bin_items;
+			mutable std::vector<int> _item_slots;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( int size, int number_items )
+				{
+					message = "The vector of sizes given to the BinPacking constraint has " + std::to_string( size )
+						+ " elements, but the constraint scope has " + std::to_string( number_items ) + " items.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			bool is_bin( int bin ) const;
+			long long overflow( int bin, long long load ) const;
+			void remove_item( int item ) const;
+			void insert_item( int item, int bin ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
+
+			double optional_variable_error( const std::vector<Variable*>& variables, int index ) const override;
+
+			void optional_variable_error_changes( const std::vector<Variable*>& variables,
+			                                      int index,
+			                                      int new_value,
+			                                      std::vector<std::pair<int, double>>& error_changes ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint, representing the bin of each item.
+			 * \param sizes a const reference to a vector of non-negative item sizes, in the same order than variables_index.
+			 * \param capacities a const reference to a vector of bin capacities.
+			 * \exception Throws if sizes does not have one element per variable.
+			 */
+			BinPacking( const std::vector<int>& variables_index,
+			            const std::vector<int>& sizes,
+			            const std::vector<int>& capacities );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint, representing the bin of each item.
+			 * \param sizes a const reference to a vector of non-negative item sizes, in the same order than variables.
+			 * \param capacities a const reference to a vector of bin capacities.
+			 * \exception Throws if sizes does not have one element per variable.
+			 */
+			BinPacking( const std::vector<Variable>& variables,
+			            const std::vector<int>& sizes,
+			            const std::vector<int>& capacities );
+		};
+	}
+}
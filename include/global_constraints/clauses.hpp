@@ -0,0 +1,141 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+#include <utility>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of a Boolean formula in Conjunctive Normal Form (CNF), i.e., a conjunction of clauses,
+		 * each clause being a disjunction of literals. A variable is considered to be true iff its value is not 0.
+		 *
+		 * Literals follow the DIMACS convention: literal k > 0 means variables[k-1] is true, and literal -k means
+		 * variables[k-1] is false, where variables are the variables in the constraint scope.
+		 *
+		 * The error is the number of unsatisfied clauses.
+		 *
+		 * Like in WalkSAT-like solvers, the number of true literals of each clause is kept, as well as the break
+		 * and make scores of each variable, i.e., the number of clauses that would respectively become unsatisfied
+		 * and satisfied by flipping this variable. The error delta of flipping one variable is then computed in O(1).
+		 * The error projected onto each variable is its make score, the number of unsatisfied clauses containing it.
+		 */
+		class Clauses : public Constraint
+		{
+			// Literals of clause c are _literals[ _clause_offsets[ c ] ] ... _literals[ _clause_offsets[ c + 1 ] - 1 ],
+			// in the DIMACS convention.
+			std::vector<int> _clause_offsets;
+			std::vector<int> _literals;
+
+			// Clauses containing variables[ i ] are _occurrences[ _occurrence_offsets[ i ] ] ... _occurrences[ _occurrence_offsets[ i + 1 ] - 1 ],
+			// a clause c being given by c+1 if it contains the positive literal, and by -(c+1) otherwise.
+			std::vector<int> _occurrence_offsets;
+			std::vector<int> _occurrences;
+
+			mutable std::vector<bool> _truth_values;
+			mutable std::vector<int> _true_count;
+			// XOR of the indexes of variables making a true literal in a clause, giving the only one when _true_count is 1.
+			mutable std::vector<int> _true_xor;
+			mutable std::vector<int> _break;
+			mutable std::vector<int> _make;
+
+			struct literalException : std::exception
+			{
+				std::string message;
+
+				literalException( int clause_index, int literal, int number_variables )
+				{
+					message = "Clause " + std::to_string( clause_index ) + " given to the Clauses constraint has literal " + std::to_string( literal )
+						+ ", but literals must be non-zero integers between -" + std::to_string( number_variables ) + " and " + std::to_string( number_variables ) + ".\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			struct emptyClauseException : std::exception
+			{
+				std::string message;
+
+				emptyClauseException( int clause_index )
+				{
+					message = "Clause " + std::to_string( clause_index ) + " given to the Clauses constraint is empty.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			void initialize_clauses( const std::vector<std::vector<int>>& clauses, int number_variables );
+			bool literal_is_true( int literal ) const;
+			void flip( int index ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			double optional_variable_error( const std::vector<Variable*>& variables, int index ) const override;
+
+			void optional_variable_error_changes( const std::vector<Variable*>& variables,
+			                                      int index,
+			                                      int new_value,
+			                                      std::vector<std::pair<int, double>>& error_changes ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param clauses a const reference to a vector of clauses, each of them being a vector of literals in the DIMACS convention, over positions in variables_index.
+			 */
+			Clauses( const std::vector<int>& variables_index, const std::vector<std::vector<int>>& clauses );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param clauses a const reference to a vector of clauses, each of them being a vector of literals in the DIMACS convention, over positions in variables.
+			 */
+			Clauses( const std::vector<Variable>& variables, const std::vector<std::vector<int>>& clauses );
+		};
+	}
+}
@@ -0,0 +1,139 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Cumulative constraint, where variables are start times of tasks with a duration and a
+		 * resource demand, such that the resource usage never exceeds a given capacity.
+		 * See http://sofdem.github.io/gccat/gccat/Ccumulative.html
+		 *
+		 * The error is the overload of the resource, summed over time.
+		 *
+		 * The load profile is stored in a lazy segment tree over the time horizon, each node keeping the minimal and
+		 * maximal load of its time range. Moving a task is a range update, and its overload change is computed by visiting
+		 * nodes until their load is constant or their range is uniformly under or over the capacity. Since the profile is
+		 * piecewise constant, this cost depends on the number of tasks overlapping the moved one, not on the horizon length.
+		 */
+		class Cumulative : public Constraint
+		{
+			std::vector<int> _durations;
+			std::vector<int> _demands;
+			int _capacity;
+
+			// Time horizon is [_horizon_start, _horizon_start + _horizon).
+			mutable int _horizon_start;
+			mutable int _horizon;
+
+			// Lazy segment tree over the horizon. _tree_min and _tree_max include the pending addition _tree_lazy of
+			// their own node but not the ones of their ancestors.
+			mutable std::vector<long long> _tree_min;
+			mutable std::vector<long long> _tree_max;
+			mutable std::vector<long long> _tree_lazy;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( const std::string& argument, int size, int number_tasks )
+				{
+					message = "The vector of " + argument + " given to the Cumulative constraint has " + std::to_string( size )
+						+ " elements, but the constraint scope has " + std::to_string( number_tasks ) + " tasks.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			void check_sizes( int number_tasks ) const;
+
+			long long overload( long long load ) const;
+
+			// Add value to the load of time range [left, right).
+			void add( int node, int node_left, int node_right, int left, int right, long long value ) const;
+
+			// Overload change if value was added to the load of time range [left, right). Loads are left unchanged.
+			long long overload_change( int node, int node_left, int node_right, int left, int right, long long value, long long pending ) const;
+
+			long long total_overload( int node, int node_left, int node_right, long long pending ) const;
+
+			void add_task( int task, int start, long long sign ) const;
+			long long task_overload_change( int task, int start, long long sign ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			bool optional_is_swap_invariant() const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint, representing task start times.
+			 * \param durations a const reference to a vector of task durations, in the same order than variables_index.
+			 * \param demands a const reference to a vector of task resource demands, in the same order than variables_index.
+			 * \param capacity the resource capacity.
+			 * \exception Throws if durations or demands do not have one element per variable.
+			 */
+			Cumulative( const std::vector<int>& variables_index,
+			            const std::vector<int>& durations,
+			            const std::vector<int>& demands,
+			            int capacity );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint, representing task start times.
+			 * \param durations a const reference to a vector of task durations, in the same order than variables.
+			 * \param demands a const reference to a vector of task resource demands, in the same order than variables.
+			 * \param capacity the resource capacity.
+			 * \exception Throws if durations or demands do not have one element per variable.
+			 */
+			Cumulative( const std::vector<Variable>& variables,
+			            const std::vector<int>& durations,
+			            const std::vector<int>& demands,
+			            int capacity );
+		};
+	}
+}
@@ -0,0 +1,103 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Element constraint x[z] = y, where x is an array of variables, z is an index
+		 * variable and y is a value variable. The variable z refers to x[0] when taking the value index_offset,
+		 * to x[1] when taking the value index_offset + 1, and so on. z and y must not belong to x.
+		 *
+		 * The error is |x[z] - y|. If z does not refer to an element of x, the error is |x[k] - y| plus the distance
+		 * between z and the closest valid index k.
+		 *
+		 * The constraint only looks at the variables whose values change: deltas of single changes and swaps are
+		 * computed in O(1).
+		 */
+		class Element : public Constraint
+		{
+			int _array_size;
+			int _index_offset;
+
+			struct emptyArrayException : std::exception
+			{
+				std::string message;
+
+				emptyArrayException()
+				{
+					message = "The array given to the Element constraint must contain at least one variable.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			int error_of( int index_value, int element_value, int value ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+		public:
+			/*!
+			 * Constructor with variable IDs. The constraint scope is the array, followed by the index variable and the value variable.
+			 * \param array_index a const reference to a vector of IDs of the array variables x.
+			 * \param index_variable the ID of the index variable z.
+			 * \param value_variable the ID of the value variable y.
+			 * \param index_offset the value of z referring to x[0]. 0 by default.
+			 * \exception Throws if the array is empty.
+			 */
+			Element( const std::vector<int>& array_index, int index_variable, int value_variable, int index_offset = 0 );
+
+			/*!
+			 * Constructor with variables. The constraint scope is the array, followed by the index variable and the value variable.
+			 * \param array a const reference to a vector of the array variables x.
+			 * \param index_variable a const reference to the index variable z.
+			 * \param value_variable a const reference to the value variable y.
+			 * \param index_offset the value of z referring to x[0]. 0 by default.
+			 * \exception Throws if the array is empty.
+			 */
+			Element( const std::vector<Variable>& array, const Variable& index_variable, const Variable& value_variable, int index_offset = 0 );
+		};
+	}
+}
@@ -53,6 +53,11 @@ namespace ghost
 			double optional_delta_error( const std::vector<Variable*>& variables,
 			                             const std::vector<int>& variable_indexes,
 			                             const std::vector<int>& candidate_values ) const override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
 	
 		public:
 			/*!
@@ -0,0 +1,155 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Global Cardinality constraint, where each given value must be taken by a number of
+		 * variables within given bounds. Values that are not given are not constrained.
+		 * See http://sofdem.github.io/gccat/gccat/Cglobal_cardinality_low_up.html
+		 *
+		 * The error is the sum, over given values, of the number of missing or exceeding occurrences.
+		 */
+		class GlobalCardinality : public Constraint
+		{
+			std::vector<int> _min_counts;
+			std::vector<int> _max_counts;
+
+			// _slots[ value - _offset ] is the index of value in the vector of given values, or -1 if value is not given.
+			std::vector<int> _slots;
+			int _offset;
+
+			mutable std::vector<int> _count;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( const std::string& argument, int size, int number_values )
+				{
+					message = "The vector of " + argument + " given to the GlobalCardinality constraint has " + std::to_string( size )
+						+ " elements, but " + std::to_string( number_values ) + " values are given.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			struct duplicatedValueException : std::exception
+			{
+				std::string message;
+
+				duplicatedValueException( int value )
+				{
+					message = "Value " + std::to_string( value ) + " is given several times to the GlobalCardinality constraint.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			int slot( int value ) const;
+			int slot_error( int slot, int count ) const;
+
+			// Change the count of value by one, and return the resulting change of error.
+			int increment( int value ) const;
+			int decrement( int value ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
+
+			void initialize_slots( const std::vector<int>& values );
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param values a const reference to the vector of constrained values.
+			 * \param min_counts a const reference to the vector of minimal numbers of occurrences, in the same order than values.
+			 * \param max_counts a const reference to the vector of maximal numbers of occurrences, in the same order than values.
+			 */
+			GlobalCardinality( const std::vector<int>& variables_index,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& min_counts,
+			                   const std::vector<int>& max_counts );
+
+			/*!
+			 * Constructor with a vector of variable IDs. This constructor calls GlobalCardinality( const std::vector<int>& variables_index, const std::vector<int>& values, const std::vector<int>& min_counts, const std::vector<int>& max_counts ), with counts as both minimal and maximal numbers of occurrences.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param values a const reference to the vector of constrained values.
+			 * \param counts a const reference to the vector of exact numbers of occurrences, in the same order than values.
+			 */
+			GlobalCardinality( const std::vector<int>& variables_index,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& counts );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param values a const reference to the vector of constrained values.
+			 * \param min_counts a const reference to the vector of minimal numbers of occurrences, in the same order than values.
+			 * \param max_counts a const reference to the vector of maximal numbers of occurrences, in the same order than values.
+			 */
+			GlobalCardinality( const std::vector<Variable>& variables,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& min_counts,
+			                   const std::vector<int>& max_counts );
+
+			/*!
+			 * Constructor with a vector of variable. This constructor calls GlobalCardinality( const std::vector<Variable>& variables, const std::vector<int>& values, const std::vector<int>& min_counts, const std::vector<int>& max_counts ), with counts as both minimal and maximal numbers of occurrences.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param values a const reference to the vector of constrained values.
+			 * \param counts a const reference to the vector of exact numbers of occurrences, in the same order than values.
+			 */
+			GlobalCardinality( const std::vector<Variable>& variables,
+			                   const std::vector<int>& values,
+			                   const std::vector<int>& counts );
+		};
+	}
+}
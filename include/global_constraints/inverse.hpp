@@ -0,0 +1,107 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Inverse channelling constraint between two arrays x and y of the same size n:
+		 * x[i] = j iff y[j] = i, for all i and j in [0, n). Values are shifted by a given offset, so that x[i] = offset
+		 * refers to y[0], and so on. In permutation problems, x and y are then inverse permutations of each other.
+		 *
+		 * A pair (i, j) is matched if x[i] = j and y[j] = i. The error is 2 * (n - number of matched pairs),
+		 * i.e., the number of variables not belonging to a matched pair.
+		 *
+		 * Values of x and y are kept in a contiguous index map, and the error delta of single changes and swaps
+		 * only looks at the pairs involving the changed variables, which is done in O(1).
+		 */
+		class Inverse : public Constraint
+		{
+			int _size;
+			int _offset;
+
+			// Contiguous copy of the values of x followed by the values of y, shifted by _offset.
+			mutable std::vector<int> _values;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( int x_size, int y_size )
+				{
+					message = "The arrays given to the Inverse constraint must have the same size, but x has " + std::to_string( x_size )
+						+ " variables and y has " + std::to_string( y_size ) + " variables.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			bool is_matched( int i, int j ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+		public:
+			/*!
+			 * Constructor with variable IDs. The constraint scope is x followed by y.
+			 * \param x_index a const reference to a vector of IDs of the variables in x.
+			 * \param y_index a const reference to a vector of IDs of the variables in y. Must have the same size than x_index.
+			 * \param offset the value referring to the first element of the other array. 0 by default.
+			 */
+			Inverse( const std::vector<int>& x_index, const std::vector<int>& y_index, int offset = 0 );
+
+			/*!
+			 * Constructor with variables. The constraint scope is x followed by y.
+			 * \param x a const reference to a vector of the variables in x.
+			 * \param y a const reference to a vector of the variables in y. Must have the same size than x.
+			 * \param offset the value referring to the first element of the other array. 0 by default.
+			 */
+			Inverse( const std::vector<Variable>& x, const std::vector<Variable>& y, int offset = 0 );
+		};
+	}
+}
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 
 #include "../variable.hpp"
 #include "../constraint.hpp"
@@ -46,6 +47,17 @@ namespace ghost
 			std::vector<double> _coefficients;
 			mutable double _current_sum;
 
+			// If all coefficients are integers, sums are computed exactly with 64-bit integers, avoiding
+			// floating-point drift over incremental updates. Otherwise, _coefficients and _current_sum are used.
+			bool _is_integer;
+			std::vector<std::int64_t> _integer_coefficients;
+			mutable std::int64_t _current_integer_sum;
+
+			// Contiguous copy of the values of variables in the scope, for vectorizable dot products.
+			mutable std::vector<std::int64_t> _values;
+
+			void initialize_integer_coefficients();
+
 		protected:
 			double rhs;
 	
@@ -68,6 +80,12 @@ namespace ghost
 
 			virtual double compute_error( double sum ) const = 0;
 
+			/*
+			 * Tells if some sum within [min_sum, max_sum] can satisfy the equation.
+			 * Used by domain filtering; must be exact if min_sum == max_sum.
+			 */
+			virtual bool is_satisfiable_within( double min_sum, double max_sum ) const = 0;
+
 			double required_error( const std::vector<Variable*>& variables ) const override;
 
 			double optional_delta_error( const std::vector<Variable*>& variables,
@@ -76,6 +94,10 @@ namespace ghost
 
 			void conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_id, int new_value ) override;
 
+			void optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
+
 		};
 	}
 }
@@ -44,6 +44,7 @@ namespace ghost
 		class LinearEquationL : public LinearEquation
 		{
 			double compute_error( double sum ) const override;
+			bool is_satisfiable_within( double min_sum, double max_sum ) const override;
 
 		public:
 			/*!
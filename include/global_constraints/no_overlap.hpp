@@ -0,0 +1,115 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+#include <set>
+#include <utility>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the NoOverlap (or Disjunctive) constraint, where variables are start times of tasks with
+		 * a duration, such that no two tasks are executed at the same time, like on a single machine.
+		 * See http://sofdem.github.io/gccat/gccat/Cdisjunctive.html
+		 *
+		 * The error is the total overlap, i.e., the sum over all pairs of tasks of the length of their intersection.
+		 *
+		 * Tasks are kept in a balanced search tree ordered by start time. Since a task starting more than the longest
+		 * duration before another one cannot overlap it, the overlap of a task is computed by visiting the tasks starting
+		 * in a window around it, in O(log n + number of tasks in the window) rather than O(n).
+		 */
+		class NoOverlap : public Constraint
+		{
+			std::vector<int> _durations;
+			int _max_duration;
+
+			// Tasks as (start time, position in the scope) pairs, ordered by start time.
+			mutable std::set<std::pair<int, int>> _tasks;
+			mutable std::vector<int> _starts;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( int size, int number_tasks )
+				{
+					message = "The vector of durations given to the NoOverlap constraint has " + std::to_string( size )
+						+ " elements, but the constraint scope has " + std::to_string( number_tasks ) + " tasks.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			// Overlap of task starting at start with the tasks in _tasks, ignoring tasks for which is_ignored returns true.
+			template<typename Predicate>
+			long long task_overlap( int task, int start, Predicate is_ignored ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			bool optional_is_swap_invariant() const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint, representing task start times.
+			 * \param durations a const reference to a vector of non-negative task durations, in the same order than variables_index.
+			 * \exception Throws if durations does not have one element per variable.
+			 */
+			NoOverlap( const std::vector<int>& variables_index, const std::vector<int>& durations );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint, representing task start times.
+			 * \param durations a const reference to a vector of non-negative task durations, in the same order than variables.
+			 * \exception Throws if durations does not have one element per variable.
+			 */
+			NoOverlap( const std::vector<Variable>& variables, const std::vector<int>& durations );
+		};
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of a network of binary inequalities x != y, one for each edge of a given graph over
+		 * the variables in the scope, like in graph colouring problems.
+		 *
+		 * The error is the number of edges whose endpoints take the same value, and the error projected onto
+		 * each variable is the number of its neighbours taking the same value than itself.
+		 *
+		 * The graph is stored in Compressed Sparse Row (CSR) form. Evaluating all candidate values of a variable
+		 * costs one pass over its neighbours, counting their values; each candidate delta is then read in O(1).
+		 */
+		class NotEqualNetwork : public Constraint
+		{
+			// Neighbours of variables[ i ] are _neighbours[ _offsets[ i ] ] ... _neighbours[ _offsets[ i + 1 ] - 1 ].
+			std::vector<int> _offsets;
+			std::vector<int> _neighbours;
+
+			// Contiguous copy of the values of variables in the scope.
+			mutable std::vector<int> _values;
+			// _conflicts[ i ] is the number of neighbours of variables[ i ] taking the same value.
+			mutable std::vector<int> _conflicts;
+
+			// _value_count[ value - _value_offset ] is the number of neighbours of variables[ _counted_variable ] taking value,
+			// or _sparse_value_count[ value ] if domain bounds span far more values than the domains contain.
+			// _counted_variable is -1 if counts are not computed.
+			mutable std::vector<int> _value_count;
+			mutable std::unordered_map<int, int> _sparse_value_count;
+			mutable int _value_offset;
+			mutable int _counted_variable;
+			mutable bool _is_dense;
+			mutable bool _is_initialized;
+
+			void initialize_graph( const std::vector<int>& variables_index, const std::vector<std::pair<int, int>>& edges );
+			int count_neighbours_with_value( int index, int value ) const;
+			void initialize_value_counts( const std::vector<Variable*>& variables ) const;
+			void count_neighbour_values( int index ) const;
+			int neighbour_value_count( int value ) const;
+			void clear_neighbour_values() const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+			double optional_variable_error( const std::vector<Variable*>& variables, int index ) const override;
+
+			void optional_variable_error_changes( const std::vector<Variable*>& variables,
+			                                      int index,
+			                                      int new_value,
+			                                      std::vector<std::pair<int, double>>& error_changes ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param edges a const reference to a vector of edges, each of them being a pair of variable IDs that must take different values.
+			 */
+			NotEqualNetwork( const std::vector<int>& variables_index, const std::vector<std::pair<int, int>>& edges );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param edges a const reference to a vector of edges, each of them being a pair of variable IDs that must take different values.
+			 */
+			NotEqualNetwork( const std::vector<Variable>& variables, const std::vector<std::pair<int, int>>& edges );
+		};
+	}
+}
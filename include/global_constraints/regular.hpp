@@ -0,0 +1,156 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+#include <tuple>
+#include <unordered_map>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Regular constraint: the sequence of values taken by the variables in the scope
+		 * must be a word recognized by a given Deterministic Finite Automaton (DFA), like in rostering rules
+		 * such as "no more than 3 night shifts in a row".
+		 *
+		 * The error is the minimal number of variables to change to get a recognized word (a Hamming distance).
+		 * If the DFA recognizes no word of the sequence length, the error is this length + 1.
+		 *
+		 * Forward and backward cost tables are kept: the forward table gives, for each position and state, the
+		 * minimal number of changes to reach this state after reading the prefix, and the backward table the minimal
+		 * number of changes to reach a final state from this state while reading the suffix. The error delta of
+		 * changing one variable is computed in O(states) from the neighbouring layers. Committing a move
+		 * recomputes layers from the changed position, stopping as soon as a layer is left unchanged.
+		 */
+		class Regular : public Constraint
+		{
+			int _length;
+			int _number_states;
+			int _initial_state;
+			int _infinity;
+
+			std::vector<bool> _is_final;
+			std::unordered_map<int, int> _symbols;
+			int _number_symbols;
+			// _transitions[ state * _number_symbols + symbol ] is the next state, or -1 if there is no such transition.
+			std::vector<int> _transitions;
+
+			// Symbols read at each position, -1 if the value is not in the DFA alphabet.
+			mutable std::vector<int> _word;
+			// Flat (_length + 1) * _number_states tables.
+			mutable std::vector<int> _forward;
+			mutable std::vector<int> _backward;
+			// _best_next[ t * _number_states + q ] is the minimal backward cost at t+1 over all transitions from q.
+			mutable std::vector<int> _best_next;
+
+			struct stateException : std::exception
+			{
+				std::string message;
+
+				stateException( const std::string& argument, int state, int number_states )
+				{
+					message = "The " + argument + " " + std::to_string( state ) + " given to the Regular constraint is not a state of the DFA, whose states are numbered from 0 to "
+						+ std::to_string( number_states - 1 ) + ".\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			struct nonDeterministicException : std::exception
+			{
+				std::string message;
+
+				nonDeterministicException( int state, int value )
+				{
+					message = "The automaton given to the Regular constraint has several transitions from state " + std::to_string( state )
+						+ " reading value " + std::to_string( value ) + ", but it must be deterministic.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			void initialize_automaton( int number_states, const std::vector<int>& final_states, const std::vector<std::tuple<int, int, int>>& transitions );
+			int symbol( int value ) const;
+			void compute_forward_layer( const int* previous, int read_symbol, int* next ) const;
+			// Compute _best_next and _backward layers at position, and return true if the backward layer changed.
+			bool compute_backward_layer( int position ) const;
+			int error_through( int position, int read_symbol ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling. The order of variables
+			 * in this vector is the order of the sequence.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param number_states the number of states of the DFA, numbered from 0.
+			 * \param initial_state the initial state.
+			 * \param final_states a const reference to the vector of final states.
+			 * \param transitions a const reference to a vector of transitions (state, value, next state).
+			 */
+			Regular( const std::vector<int>& variables_index,
+			         int number_states,
+			         int initial_state,
+			         const std::vector<int>& final_states,
+			         const std::vector<std::tuple<int, int, int>>& transitions );
+
+			/*!
+			 * Constructor with a vector of variable. The order of variables in this vector is the order of the sequence.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param number_states the number of states of the DFA, numbered from 0.
+			 * \param initial_state the initial state.
+			 * \param final_states a const reference to the vector of final states.
+			 * \param transitions a const reference to a vector of transitions (state, value, next state).
+			 */
+			Regular( const std::vector<Variable>& variables,
+			         int number_states,
+			         int initial_state,
+			         const std::vector<int>& final_states,
+			         const std::vector<std::tuple<int, int, int>>& transitions );
+		};
+	}
+}
@@ -0,0 +1,122 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <exception>
+#include <cstdint>
+#include <unordered_map>
+
+#include "../variable.hpp"
+#include "../constraint.hpp"
+
+namespace ghost
+{
+	namespace global_constraints
+	{
+		/*!
+		 * Implementation of the Table constraint, a.k.a. extensional constraint, given either by a list
+		 * of allowed tuples or by a list of forbidden tuples.
+		 * See http://sofdem.github.io/gccat/gccat/Cin_relation.html
+		 *
+		 * The error is 0 if the constraint is satisfied, and 1 otherwise.
+		 *
+		 * Tuples are stored contiguously and indexed by a Zobrist hash. Changing the value of a variable updates
+		 * the hash in constant time, so the error delta of a move costs one hash table lookup.
+		 */
+		class Table : public Constraint
+		{
+			int _arity;
+			bool _forbidden;
+
+			// Tuples stored contiguously, tuple t being _tuples[ t * _arity ] ... _tuples[ ( t + 1 ) * _arity - 1 ].
+			std::vector<int> _tuples;
+			// Maps the hash of a tuple to the index of the first tuple with this hash.
+			std::unordered_map<std::uint64_t, int> _first_tuple;
+			// _next_tuple[ t ] is the index of the next tuple with the same hash than tuple t, or -1.
+			std::vector<int> _next_tuple;
+
+			mutable std::vector<int> _values;
+			mutable std::uint64_t _current_hash;
+
+			struct tupleSizeException : std::exception
+			{
+				std::string message;
+
+				tupleSizeException( int tuple_index, int tuple_size, int arity )
+				{
+					message = "Tuple num. " + std::to_string( tuple_index ) + " given to the Table constraint has "
+						+ std::to_string( tuple_size ) + " values, but the constraint scope has "
+						+ std::to_string( arity ) + " variables.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			static std::uint64_t key( int position, int value );
+			void initialize_tuples( const std::vector<std::vector<int>>& tuples );
+			bool contains( std::uint64_t hash, const std::vector<int>& values ) const;
+			double error_for( bool is_in_table ) const;
+
+			double required_error( const std::vector<Variable*>& variables ) const override;
+
+			double optional_delta_error( const std::vector<Variable*>& variables,
+			                             const std::vector<int>& variable_indexes,
+			                             const std::vector<int>& candidate_values ) const override;
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables,
+			                                         int variable_index,
+			                                         int new_value ) override;
+
+			void optional_filter_domains( const std::vector<Variable*>& variables,
+			                              std::vector<std::vector<int>>& domains ) const override;
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs. This vector is internally used by ghost::Constraint
+			 * to know what variables from the global variable vector it is handling.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the constraint.
+			 * \param tuples a const reference to a vector of tuples, each of them of the size of the constraint scope.
+			 * \param forbidden a Boolean, true iff tuples are forbidden ones rather than allowed ones. False by default.
+			 * \exception Throws if a tuple size differs from the number of variables.
+			 */
+			Table( const std::vector<int>& variables_index, const std::vector<std::vector<int>>& tuples, bool forbidden = false );
+
+			/*!
+			 * Constructor with a vector of variable.
+			 * \param variables a const reference to a vector of variables composing the constraint.
+			 * \param tuples a const reference to a vector of tuples, each of them of the size of the constraint scope.
+			 * \param forbidden a Boolean, true iff tuples are forbidden ones rather than allowed ones. False by default.
+			 * \exception Throws if a tuple size differs from the number of variables.
+			 */
+			Table( const std::vector<Variable>& variables, const std::vector<std::vector<int>>& tuples, bool forbidden = false );
+		};
+	}
+}
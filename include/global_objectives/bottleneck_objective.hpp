@@ -0,0 +1,273 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <set>
+#include <string>
+#include <limits>
+#include <utility>
+#include <type_traits>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../objective.hpp"
+
+namespace ghost
+{
+	namespace global_objectives
+	{
+		/*!
+		 * Implementation of bottleneck objective functions over terms c_i*x_i + d_i, one for each variable:
+		 * minimizing the maximal term with BottleneckObjective<Minimize> (or MinimizeMax), like a makespan
+		 * where terms are task end times, and maximizing the minimal term with BottleneckObjective<Maximize>
+		 * (or MaximizeMin).
+		 *
+		 * Terms are kept in a balanced search tree ordered by value. Updates and delta costs run in O(log n),
+		 * and the value heuristic evaluates all candidate values in a single pass without assigning the variable.
+		 * Variables whose term equals the bottleneck are given as critical variables, so that the search focuses
+		 * on them once constraints are satisfied.
+		 */
+		template<typename Direction>
+		class BottleneckObjective : public Direction
+		{
+			static_assert( std::is_same_v<Direction, Minimize> || std::is_same_v<Direction, Maximize>,
+			               "BottleneckObjective must be a Minimize or a Maximize objective." );
+
+			// The cost is the maximal term when minimizing, and the minimal term when maximizing.
+			static constexpr bool is_max_bottleneck = std::is_same_v<Direction, Minimize>;
+
+			std::vector<double> _coefficients;
+			std::vector<double> _offsets;
+
+			// Terms as (value, index) pairs, ordered by value.
+			mutable std::set<std::pair<double, int>> _terms;
+			mutable std::vector<double> _term_values;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( const std::string& argument, int size, int number_variables )
+				{
+					message = "The vector of " + argument + " given to the BottleneckObjective objective function has " + std::to_string( size )
+						+ " elements, but its scope has " + std::to_string( number_variables ) + " variables.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			inline void check_sizes( int number_variables ) const
+			{
+				if( static_cast<int>( _coefficients.size() ) != number_variables )
+					throw sizeException( "coefficients", static_cast<int>( _coefficients.size() ), number_variables );
+
+				if( static_cast<int>( _offsets.size() ) != number_variables )
+					throw sizeException( "offsets", static_cast<int>( _offsets.size() ), number_variables );
+			}
+
+			inline double term( int index, int value ) const { return _coefficients[ index ] * value + _offsets[ index ]; }
+
+			inline double neutral() const
+			{
+				return is_max_bottleneck ? std::numeric_limits<double>::lowest() : std::numeric_limits<double>::max();
+			}
+
+			inline double bottleneck( double first, double second ) const
+			{
+				return is_max_bottleneck ? std::max( first, second ) : std::min( first, second );
+			}
+
+			// Bottleneck of terms whose index is not ignored, visiting terms from the bottleneck.
+			template<typename Predicate>
+			double bottleneck_without( Predicate is_ignored ) const
+			{
+				if constexpr( is_max_bottleneck )
+				{
+					for( auto it = _terms.rbegin() ; it != _terms.rend() ; ++it )
+						if( !is_ignored( it->second ) )
+							return it->first;
+				}
+				else
+				{
+					for( auto it = _terms.begin() ; it != _terms.end() ; ++it )
+						if( !is_ignored( it->second ) )
+							return it->first;
+				}
+
+				return neutral();
+			}
+
+			double required_cost( const std::vector<Variable*>& variables ) const override
+			{
+				_terms.clear();
+				for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+				{
+					_term_values[ index ] = term( index, variables[ index ]->get_value() );
+					_terms.emplace( _term_values[ index ], index );
+				}
+
+				return _terms.empty() ? 0.0 : bottleneck_without( []( int ){ return false; } );
+			}
+
+			double optional_delta_cost( const std::vector<Variable*>& variables,
+			                            const std::vector<int>& indexes,
+			                            const std::vector<int>& candidate_values ) const override
+			{
+				double candidate_cost = bottleneck_without( [&]( int index ){ return std::find( indexes.begin(), indexes.end(), index ) != indexes.end(); } );
+				for( int i = 0 ; i < static_cast<int>( indexes.size() ) ; ++i )
+					candidate_cost = bottleneck( candidate_cost, term( indexes[ i ], candidate_values[ i ] ) );
+
+				return candidate_cost - bottleneck_without( []( int ){ return false; } );
+			}
+
+			void conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value ) override
+			{
+				_terms.erase( { _term_values[ index ], index } );
+				_term_values[ index ] = term( index, new_value );
+				_terms.emplace( _term_values[ index ], index );
+			}
+
+			int expert_heuristic_value( const std::vector<Variable*>& variables,
+			                            int variable_index,
+			                            const std::vector<int>& possible_values,
+			                            randutils::mt19937_rng& rng ) const override
+			{
+				if( possible_values.empty() )
+					return variables[ variable_index ]->get_value();
+
+				double others = bottleneck_without( [&]( int index ){ return index == variable_index; } );
+				double sign = is_max_bottleneck ? 1.0 : -1.0;
+				double min_cost = std::numeric_limits<double>::max();
+				std::vector<int> best_values;
+
+				for( int value : possible_values )
+				{
+					double cost = sign * bottleneck( others, term( variable_index, value ) );
+					if( min_cost > cost )
+					{
+						min_cost = cost;
+						best_values.assign( 1, value );
+					}
+					else
+						if( min_cost == cost )
+							best_values.push_back( value );
+				}
+
+				return rng.pick( best_values );
+			}
+
+			std::vector<int> expert_critical_variables( const std::vector<Variable*>& variables ) const override
+			{
+				std::vector<int> critical;
+				if( _terms.empty() )
+					return critical;
+
+				double cost = bottleneck_without( []( int ){ return false; } );
+				if constexpr( is_max_bottleneck )
+				{
+					for( auto it = _terms.rbegin() ; it != _terms.rend() && it->first == cost ; ++it )
+						critical.push_back( it->second );
+				}
+				else
+				{
+					for( auto it = _terms.begin() ; it != _terms.end() && it->first == cost ; ++it )
+						critical.push_back( it->second );
+				}
+
+				return critical;
+			}
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 * \param coefficients a const reference to the vector of term coefficients c_i, in the same order than variables_index.
+			 * \param offsets a const reference to the vector of term offsets d_i, in the same order than variables_index.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			BottleneckObjective( const std::vector<int>& variables_index,
+			                     const std::vector<double>& coefficients,
+			                     const std::vector<double>& offsets,
+			                     const std::string& name = "BottleneckObjective" )
+				: Direction( variables_index, name ),
+				  _coefficients( coefficients ),
+				  _offsets( offsets ),
+				  _term_values( variables_index.size() )
+			{
+				check_sizes( static_cast<int>( variables_index.size() ) );
+			}
+
+			/*!
+			 * Constructor with a vector of variable IDs, where terms are the variables themselves.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			BottleneckObjective( const std::vector<int>& variables_index,
+			                     const std::string& name = "BottleneckObjective" )
+				: BottleneckObjective( variables_index, std::vector<double>( variables_index.size(), 1.0 ), std::vector<double>( variables_index.size(), 0.0 ), name )
+			{ }
+
+			/*!
+			 * Constructor with a vector of variables.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 * \param coefficients a const reference to the vector of term coefficients c_i, in the same order than variables.
+			 * \param offsets a const reference to the vector of term offsets d_i, in the same order than variables.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			BottleneckObjective( const std::vector<Variable>& variables,
+			                     const std::vector<double>& coefficients,
+			                     const std::vector<double>& offsets,
+			                     const std::string& name = "BottleneckObjective" )
+				: Direction( variables, name ),
+				  _coefficients( coefficients ),
+				  _offsets( offsets ),
+				  _term_values( variables.size() )
+			{
+				check_sizes( static_cast<int>( variables.size() ) );
+			}
+
+			/*!
+			 * Constructor with a vector of variables, where terms are the variables themselves.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			BottleneckObjective( const std::vector<Variable>& variables,
+			                     const std::string& name = "BottleneckObjective" )
+				: BottleneckObjective( variables, std::vector<double>( variables.size(), 1.0 ), std::vector<double>( variables.size(), 0.0 ), name )
+			{ }
+		};
+
+		//! Objective function minimizing the maximal term.
+		using MinimizeMax = BottleneckObjective<Minimize>;
+
+		//! Objective function maximizing the minimal term.
+		using MaximizeMin = BottleneckObjective<Maximize>;
+	}
+}
@@ -0,0 +1,172 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../objective.hpp"
+
+namespace ghost
+{
+	namespace global_objectives
+	{
+		/*!
+		 * Implementation of a linear objective function, i.e., a weighted sum of variables
+		 * c_1*x_1 + c_2*x_2 + ... + c_n*x_n, to minimize or to maximize.
+		 *
+		 * The template parameter Direction must be ghost::Minimize or ghost::Maximize, for instance
+		 * LinearObjective<Maximize> for a knapsack value.
+		 *
+		 * The cost delta of changing some variables only depends on their coefficients: it is computed
+		 * in O(1) per changed variable, and the value heuristic evaluates all candidate values in a single
+		 * pass without assigning the variable. The running cost is maintained by the solver from these
+		 * deltas, so required_cost is only called to initialize it, and to recompute it exactly when a
+		 * better cost is found.
+		 */
+		template<typename Direction>
+		class LinearObjective : public Direction
+		{
+			static_assert( std::is_same_v<Direction, Minimize> || std::is_same_v<Direction, Maximize>,
+			               "LinearObjective must be a Minimize or a Maximize objective." );
+
+			std::vector<double> _coefficients;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( int size, int number_variables )
+				{
+					message = "The vector of coefficients given to the LinearObjective objective function has " + std::to_string( size )
+						+ " elements, but its scope has " + std::to_string( number_variables ) + " variables.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			inline void check_size( int number_variables ) const
+			{
+				if( static_cast<int>( _coefficients.size() ) != number_variables )
+					throw sizeException( static_cast<int>( _coefficients.size() ), number_variables );
+			}
+
+			double required_cost( const std::vector<Variable*>& variables ) const override
+			{
+				double cost = 0.0;
+				for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+					cost += _coefficients[ index ] * variables[ index ]->get_value();
+
+				return cost;
+			}
+
+			double optional_delta_cost( const std::vector<Variable*>& variables,
+			                            const std::vector<int>& indexes,
+			                            const std::vector<int>& candidate_values ) const override
+			{
+				double delta = 0.0;
+				for( int i = 0 ; i < static_cast<int>( indexes.size() ) ; ++i )
+					delta += _coefficients[ indexes[ i ] ] * ( candidate_values[ i ] - variables[ indexes[ i ] ]->get_value() );
+
+				return delta;
+			}
+
+			bool optional_is_separable() const override
+			{
+				return true;
+			}
+
+			int expert_heuristic_value( const std::vector<Variable*>& variables,
+			                            int variable_index,
+			                            const std::vector<int>& possible_values,
+			                            randutils::mt19937_rng& rng ) const override
+			{
+				if( possible_values.empty() )
+					return variables[ variable_index ]->get_value();
+
+				// The sign of the coefficient tells if the lowest or the highest value is the best one.
+				double coefficient = this->is_maximization() ? -_coefficients[ variable_index ] : _coefficients[ variable_index ];
+				if( coefficient == 0.0 )
+					return rng.pick( possible_values );
+
+				double min_cost = std::numeric_limits<double>::max();
+				std::vector<int> best_values;
+				for( int value : possible_values )
+				{
+					double cost = coefficient * value;
+					if( min_cost > cost )
+					{
+						min_cost = cost;
+						best_values.assign( 1, value );
+					}
+					else
+						if( min_cost == cost )
+							best_values.push_back( value );
+				}
+
+				return rng.pick( best_values );
+			}
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 * \param coefficients a const reference to the vector of coefficients, in the same order than variables_index.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			LinearObjective( const std::vector<int>& variables_index,
+			                 const std::vector<double>& coefficients,
+			                 const std::string& name = "LinearObjective" )
+				: Direction( variables_index, name ),
+				  _coefficients( coefficients )
+			{
+				check_size( static_cast<int>( variables_index.size() ) );
+			}
+
+			/*!
+			 * Constructor with a vector of variables.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 * \param coefficients a const reference to the vector of coefficients, in the same order than variables.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			LinearObjective( const std::vector<Variable>& variables,
+			                 const std::vector<double>& coefficients,
+			                 const std::string& name = "LinearObjective" )
+				: Direction( variables, name ),
+				  _coefficients( coefficients )
+			{
+				check_size( static_cast<int>( variables.size() ) );
+			}
+		};
+	}
+}
@@ -0,0 +1,202 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <type_traits>
+#include <exception>
+
+#include "../variable.hpp"
+#include "../objective.hpp"
+
+namespace ghost
+{
+	namespace global_objectives
+	{
+		/*!
+		 * Implementation of a separable objective function, i.e., a sum of per-variable costs
+		 * f_1(x_1) + f_2(x_2) + ... + f_n(x_n), to minimize or to maximize. Each function f_i is
+		 * given as a table of costs indexed by values: f_i(v) = costs[i][v - value_offset].
+		 * Tables must cover the domain of their variable. This is checked by the constructor taking variables,
+		 * and by required_cost otherwise, since the domains of variables are unknown from their IDs.
+		 *
+		 * The template parameter Direction must be ghost::Minimize or ghost::Maximize.
+		 *
+		 * The cost delta of changing some variables is computed with two table lookups per changed
+		 * variable, and the value heuristic evaluates all candidate values in a single pass without
+		 * assigning the variable. The running cost is maintained by the solver from these deltas, so
+		 * required_cost is only called to initialize it, and to recompute it exactly when a better cost is found.
+		 */
+		template<typename Direction>
+		class SeparableObjective : public Direction
+		{
+			static_assert( std::is_same_v<Direction, Minimize> || std::is_same_v<Direction, Maximize>,
+			               "SeparableObjective must be a Minimize or a Maximize objective." );
+
+			std::vector<std::vector<double>> _costs;
+			int _value_offset;
+
+			struct sizeException : std::exception
+			{
+				std::string message;
+
+				sizeException( int size, int number_variables )
+				{
+					message = "The vector of cost tables given to the SeparableObjective objective function has " + std::to_string( size )
+						+ " elements, but its scope has " + std::to_string( number_variables ) + " variables.\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			struct tableException : std::exception
+			{
+				std::string message;
+
+				tableException( int index, int min_value, int max_value )
+				{
+					message = "The cost table of variable " + std::to_string( index ) + " given to the SeparableObjective objective function does not cover its domain ["
+						+ std::to_string( min_value ) + ", " + std::to_string( max_value ) + "].\n";
+				}
+				const char* what() const noexcept { return message.c_str(); }
+			};
+
+			inline double value_cost( int index, int value ) const { return _costs[ index ][ value - _value_offset ]; }
+
+			inline void check_size( int number_variables ) const
+			{
+				if( static_cast<int>( _costs.size() ) != number_variables )
+					throw sizeException( static_cast<int>( _costs.size() ), number_variables );
+			}
+
+			inline void check_table( int index, int min_value, int max_value ) const
+			{
+				if( static_cast<long long>( min_value ) < _value_offset
+				    || static_cast<long long>( max_value ) - _value_offset >= static_cast<long long>( _costs[ index ].size() ) )
+					throw tableException( index, min_value, max_value );
+			}
+
+			double required_cost( const std::vector<Variable*>& variables ) const override
+			{
+				for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+					check_table( index, variables[ index ]->get_domain_min_value(), variables[ index ]->get_domain_max_value() );
+
+				double cost = 0.0;
+				for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+					cost += value_cost( index, variables[ index ]->get_value() );
+
+				return cost;
+			}
+
+			double optional_delta_cost( const std::vector<Variable*>& variables,
+			                            const std::vector<int>& indexes,
+			                            const std::vector<int>& candidate_values ) const override
+			{
+				double delta = 0.0;
+				for( int i = 0 ; i < static_cast<int>( indexes.size() ) ; ++i )
+					delta += value_cost( indexes[ i ], candidate_values[ i ] ) - value_cost( indexes[ i ], variables[ indexes[ i ] ]->get_value() );
+
+				return delta;
+			}
+
+			bool optional_is_separable() const override
+			{
+				return true;
+			}
+
+			int expert_heuristic_value( const std::vector<Variable*>& variables,
+			                            int variable_index,
+			                            const std::vector<int>& possible_values,
+			                            randutils::mt19937_rng& rng ) const override
+			{
+				if( possible_values.empty() )
+					return variables[ variable_index ]->get_value();
+
+				double sign = this->is_maximization() ? -1.0 : 1.0;
+				double min_cost = std::numeric_limits<double>::max();
+				std::vector<int> best_values;
+				for( int value : possible_values )
+				{
+					double cost = sign * value_cost( variable_index, value );
+					if( min_cost > cost )
+					{
+						min_cost = cost;
+						best_values.assign( 1, value );
+					}
+					else
+						if( min_cost == cost )
+							best_values.push_back( value );
+				}
+
+				return rng.pick( best_values );
+			}
+
+		public:
+			/*!
+			 * Constructor with a vector of variable IDs.
+			 * \param variables_index a const reference to a vector of IDs of variables composing the objective function.
+			 * \param costs a const reference to the vector of cost tables, in the same order than variables_index.
+			 * \param value_offset the value corresponding to the first entry of cost tables. 0 by default.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			SeparableObjective( const std::vector<int>& variables_index,
+			                    const std::vector<std::vector<double>>& costs,
+			                    int value_offset = 0,
+			                    const std::string& name = "SeparableObjective" )
+				: Direction( variables_index, name ),
+				  _costs( costs ),
+				  _value_offset( value_offset )
+			{
+				check_size( static_cast<int>( variables_index.size() ) );
+			}
+
+			/*!
+			 * Constructor with a vector of variables.
+			 * \param variables a const reference to a vector of variables composing the objective function.
+			 * \param costs a const reference to the vector of cost tables, in the same order than variables.
+			 * \param value_offset the value corresponding to the first entry of cost tables. 0 by default.
+			 * \param name a const reference to a string to give a name to the objective function.
+			 */
+			SeparableObjective( const std::vector<Variable>& variables,
+			                    const std::vector<std::vector<double>>& costs,
+			                    int value_offset = 0,
+			                    const std::string& name = "SeparableObjective" )
+				: Direction( variables, name ),
+				  _costs( costs ),
+				  _value_offset( value_offset )
+			{
+				check_size( static_cast<int>( variables.size() ) );
+				for( int index = 0 ; index < static_cast<int>( variables.size() ) ; ++index )
+					check_table( index, variables[ index ].get_domain_min_value(), variables[ index ].get_domain_max_value() );
+			}
+		};
+	}
+}
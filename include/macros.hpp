@@ -38,14 +38,36 @@
 #define COUT std::cout
 #endif
 
-#if defined GHOST_RANDOM_WALK
+// Random Walk and Hill Climbing are made for landscape analysis and trace their search by default.
+// Define GHOST_NO_TRACE to run them silently, for instance to benchmark them.
+#if defined GHOST_RANDOM_WALK && !defined GHOST_NO_TRACE
 #define GHOST_TRACE
 #endif
 
-#if defined GHOST_HILL_CLIMBING
+#if defined GHOST_HILL_CLIMBING && !defined GHOST_NO_TRACE
 #define GHOST_TRACE
 #endif
 
 #if defined GHOST_FITNESS_CLOUD
 #define GHOST_TRACE
 #endif
+
+// Per-phase profiling of SearchUnit, see SearchProfile. These macros are meant to be used in SearchUnit methods only,
+// where 'data' is the SearchUnitData object. They expand to nothing unless GHOST_PROFILE is given to the compiler.
+#if defined GHOST_PROFILE
+#define GHOST_PROFILE_ITERATION() ghost::SearchProfile::IterationTimer ghost_profile_iteration( data.profile )
+#define GHOST_PROFILE_START( phase ) auto ghost_profile_start_##phase = std::chrono::steady_clock::now()
+#define GHOST_PROFILE_STOP( phase ) data.profile.add( ghost::SearchProfile::phase, std::chrono::steady_clock::now() - ghost_profile_start_##phase )
+#else
+#define GHOST_PROFILE_ITERATION()
+#define GHOST_PROFILE_START( phase )
+#define GHOST_PROFILE_STOP( phase )
+#endif
+
+// Binary trajectory recording of SearchUnit, see TrajectoryRecorder. Same restrictions as profiling macros,
+// with 'trajectory' the TrajectoryBuffer pointer of the search unit. They expand to nothing unless GHOST_RECORD is given to the compiler.
+#if defined GHOST_RECORD
+#define GHOST_RECORD_EVENT( type, variable, value, delta, error ) do { if( trajectory ) trajectory->record( ghost::TrajectoryEvent::type, data.search_iterations, variable, value, delta, error ); } while( false )
+#else
+#define GHOST_RECORD_EVENT( type, variable, value, delta, error )
+#endif
@@ -76,6 +76,8 @@ namespace ghost
 		std::map<int,int> _variables_position; // To know where are global variables in the constraint's variables vector. 
 		bool _is_optimization;
 		bool _is_maximization;
+		mutable bool _is_optional_delta_cost_defined; // Boolean telling if optional_delta_cost() is overrided or not.
+		int _heuristic_value_threads; // Number of threads evaluating candidate values in expert_heuristic_value() without optional_delta_cost().
 		std::string _name; // Name of the objective object.
 
 		struct nanException : std::exception
@@ -93,6 +95,17 @@ namespace ghost
 			const char* what() const noexcept { return message.c_str(); }
 		};
 
+		struct deltaCostNotDefinedException : std::exception
+		{
+			std::string message;
+
+			deltaCostNotDefinedException()
+			{
+				message = "Objective::optional_delta_cost() has not been user-defined.\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
 		struct variableOutOfTheScope : std::exception
 		{
 			std::string message;
@@ -107,18 +120,55 @@ namespace ghost
 		Objective( const std::vector<int>& variables_index, bool is_maximization, const std::string& name );
 		Objective( const std::vector<Variable>& variables, bool is_maximization, const std::string& name );
 
-		inline void update( int index, int new_value ) { conditional_update_data_structures( _variables, _variables_position[ index ], new_value ); }
+		// Variables out of the scope of the objective function are ignored.
+		inline void update( int index, int new_value )
+		{
+			auto it = _variables_position.find( index );
+			if( it != _variables_position.end() )
+				conditional_update_data_structures( _variables, it->second, new_value );
+		}
 
 		// Call required_cost() on Objective::_variables after making sure the cost does not give a nan, rise an exception otherwise.
 		double cost() const;
 
+		inline bool is_optional_delta_cost_defined() const { return _is_optional_delta_cost_defined; }
+
+		// Compute the delta cost of the current assignment, giving a vector of variables index and their candidate values.
+		// Calling optional_delta_cost after making the conversion of variables index, ignoring variables out of the scope.
+		// Getting sure the delta cost does give a nan, rise an exception otherwise. Like cost(), the output is negated for maximization.
+		double delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const;
+
+		// To simulate the cost delta between the current configuration and the candidate configuration.
+		// This calls delta_cost() if the user overrided it, otherwise it makes the simulation 'by hand' and calls cost() twice.
+		double simulate_delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const;
+
+		// Compute the cost of each candidate value of variables[ variable_index ], up to a constant, without assigning the variable.
+		// Use optional_delta_cost if the user overrided it, otherwise call required_cost on copies of variables, in parallel if required.
+		std::vector<double> candidate_costs( const std::vector<Variable*>& variables, int variable_index, const std::vector<int>& possible_values ) const;
+
 		// Call expert_heuristic_value on Objective::_variables.
+		// The cost does not depend on variables outside the objective scope, so all their values are equivalent.
 		inline int heuristic_value( int variable_index, const std::vector<int>& possible_values, randutils::mt19937_rng& rng ) const
-		{ return expert_heuristic_value( _variables, _variables_position.at( variable_index ), possible_values, rng ); }
+		{
+			auto it = _variables_position.find( variable_index );
+			if( it == _variables_position.end() )
+				return rng.pick( possible_values );
+
+			return expert_heuristic_value( _variables, it->second, possible_values, rng );
+		}
 
 		// Call expert_heuristic_value_permutation on Objective::_variables.
 		inline int heuristic_value_permutation( int variable_index, const std::vector<int>& bad_variables, randutils::mt19937_rng& rng ) const
-		{ return expert_heuristic_value_permutation( _variables, _variables_position.at( variable_index ), bad_variables, rng ); }
+		{
+			auto it = _variables_position.find( variable_index );
+			if( it == _variables_position.end() )
+				return rng.pick( bad_variables );
+
+			return expert_heuristic_value_permutation( _variables, it->second, bad_variables, rng );
+		}
+
+		// Call expert_critical_variables on Objective::_variables, and convert indexes into variable IDs.
+		std::vector<int> critical_variables() const;
 
 		// Call expert_postprocess on Objective::_variables.
 		inline double postprocess( double best_cost ) const
@@ -161,6 +211,39 @@ namespace ghost
 		 */
 		virtual void conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value );
 
+		/*!
+		 * Virtual method to compute the difference, or delta, between the current cost and
+		 * the cost of a candidate assignment.
+		 *
+		 * Giving a vector of variable indexes and their respective candidate value, this method
+		 * outputs the difference between the cost of the current assignment in 'variables' given
+		 * as input and the cost we would get if we assign new candidate values. A single index
+		 * corresponds to a variable changing its value, and two indexes with exchanged values to
+		 * a swap in permutation problems.
+		 *
+		 * Like required_cost, the output must not be negated for maximization problems: the
+		 * solver takes care of it.
+		 *
+		 * Once this method is defined, the solver evaluates candidate moves in optimization-guided
+		 * search without assigning variables and computing the full cost. It can rely on data
+		 * structures initialized in required_cost and maintained by conditional_update_data_structures.
+		 * Notice that it is called before the auxiliary data are updated.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory.
+		 *
+		 * \warning DO NOT implement any side effect in this method.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the scope
+		 * of the objective function. The solver is calling this method with the vector of variables
+		 * that has been given to the constructor.
+		 * \param indexes the vector of indexes of variables that are reassigned.
+		 * \param candidate_values the vector of their respective candidate values.
+		 * \return A double corresponding to the difference between the cost one would get if the
+		 * solver assigns candidate values to given variables and the current cost.
+		 * \exception Throws an exception if the computed value is NaN.
+		 */
+		virtual double optional_delta_cost( const std::vector<Variable*>& variables, const std::vector<int>& indexes, const std::vector<int>& candidate_values ) const;
+
 		/*!
 		 * Virtual method to apply the value heuristic used by the solver for non permutation
 		 * problems.
@@ -171,7 +254,9 @@ namespace ghost
 		 *
 		 * The default implementation outputs the value leading to the lowest objective cost.
 		 * If two or more values lead to configurations with the same lowest cost, one of them
-		 * is randomly returned.
+		 * is randomly returned. Candidate values are evaluated with optional_delta_cost if it is
+		 * defined, and with required_cost on a copy of the changed variable otherwise, such that variables
+		 * are never assigned. See set_heuristic_value_threads to evaluate them in parallel.
 		 *
 		 * Like any methods prefixed by 'expert_', users should override this method only if they
 		 * know what they are doing.
@@ -216,6 +301,37 @@ namespace ghost
 		                                                const std::vector<int>& bad_variables,
 		                                                randutils::mt19937_rng& rng ) const;
 
+		/*!
+		 * Virtual method giving the variables the objective cost currently depends on, such as the
+		 * variables defining the bottleneck of a min/max objective function.
+		 *
+		 * Once all constraints are satisfied, the solver focuses on these variables when selecting
+		 * the variable to change. By default, it returns an empty vector, meaning that all variables
+		 * are considered.
+		 *
+		 * Like any methods prefixed by 'expert_', users should override this method only if
+		 * they know what they are doing.
+		 *
+		 * \param variables a const reference of the vector of raw pointers of variables in the
+		 * scope of the objective function.
+		 * \return The vector of indexes in 'variables' of critical variables.
+		 */
+		virtual std::vector<int> expert_critical_variables( const std::vector<Variable*>& variables ) const;
+
+		/*!
+		 * Virtual method telling if the objective function is a sum of terms, each of them depending
+		 * on a single variable, like a linear objective function.
+		 *
+		 * If the model is composed of independent subproblems, Solver::complete_search then evaluates
+		 * the solutions of each subproblem separately, rather than evaluating every combination of them.
+		 *
+		 * Like any methods prefixed by 'optional_', overriding this method is not mandatory. By
+		 * default, objective functions are not considered to be separable.
+		 *
+		 * \return True iff the cost is a sum of terms depending on one variable each.
+		 */
+		virtual bool optional_is_separable() const;
+
 		/*!
 		 * Virtual method to perform post-processing optimization.
 		 *
@@ -265,6 +381,17 @@ namespace ghost
 		//! Inline accessor to get the name of the objective object.
 		inline std::string get_name() const { return _name; }
 
+		/*!
+		 * Set the number of threads evaluating candidate values in the default expert_heuristic_value,
+		 * when optional_delta_cost is not defined. 1 by default, i.e., no parallel evaluations.
+		 *
+		 * This is only worth it for expensive required_cost methods, since threads are created on each
+		 * call. In that case, required_cost must be safe to call concurrently on different variables.
+		 *
+		 * \param number_threads the number of threads.
+		 */
+		inline void set_heuristic_value_threads( int number_threads ) { _heuristic_value_threads = std::max( 1, number_threads ); }
+
 		//! Inline method returning if a user-defined objective function has been declared.
 		inline bool is_optimization() const { return _is_optimization; }
 
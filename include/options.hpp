@@ -31,6 +31,8 @@
 
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <string>
 
 #include "print.hpp"
 
@@ -47,6 +49,7 @@ namespace ghost
 		bool resume_search; //!< Allowing stop-and-resume computation.
 		bool parallel_runs; //!< To enable parallel runs of the solver. Using all available physical cores if number_threads is not specified.
 		bool enable_optimization_guidance; //!< For optimization problems, consider the optimization cost as a tie-breaker for satisfaction plateau.
+		bool preprocessing; //!< To filter variable domains with node and arc consistency before running Solver::fast_search.
 		int number_threads; //!< Number of threads the solver will use for the search.
 		std::shared_ptr<Print> print; //!< Allowing custom solution print (by derivating a class from ghost::Print)
 		int tabu_time_local_min; //!< Number of local moves a variable of a local minimum is marked tabu.
@@ -56,6 +59,10 @@ namespace ghost
 		int restart_threshold; //!< Trigger a restart every 'restart_threshold' reset. Set to 0 to never trigger restarts.
 		int number_variables_to_reset; //!< Number of variables to randomly change the value at each reset.
 		int number_start_samplings; //!< Number of variable assignments the solver randomly draw, if custom_starting_point and resume_search are false.
+		int node_limit; //!< Maximal number of nodes Solver::complete_search can explore. No limit if 0 or negative.
+		std::shared_ptr<std::atomic<bool>> cancel_search; //!< Shared flag to set from another thread to stop Solver::complete_search. Ignored if null.
+		int seed; //!< Seed of the pseudo-random generators of Solver::fast_search, for reproducible runs. Thread i uses seed + i. Random seeds if negative.
+		std::string trajectory_file; //!< Binary file where Solver::fast_search records its trajectory if the macro GHOST_RECORD is given to the compiler, see TrajectoryRecorder. "ghost_trajectory.bin" by default.
 
 		//! Unique constructor
 		Options();
@@ -0,0 +1,183 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+
+namespace ghost
+{
+	/*!
+	 * SearchProfile is a structure containing the time spent in each phase of the iterations of
+	 * Solver::fast_search, as well as a latency histogram of these iterations. Profiles of the
+	 * last call of Solver::fast_search are available through Solver::get_search_profile and
+	 * Solver::get_search_profiles.
+	 *
+	 * Profiles are only filled if the macro GHOST_PROFILE is given to the compiler: since measuring
+	 * time on the hot path of the search has a cost, profiling is disabled at compile time by default.
+	 * Otherwise, all counters are zero.
+	 *
+	 * Times are wall-clock times in nanoseconds, measured with std::chrono::steady_clock.
+	 *
+	 * \sa Solver
+	 */
+	struct SearchProfile
+	{
+		//! Phases of a search iteration.
+		enum Phase
+		{
+			CandidateComputation, //!< Computing variable candidates, and critical variables of the objective function.
+			VariableSelection, //!< Selecting the variable to change among candidates.
+			DeltaEvaluation, //!< Evaluating the error delta of each neighbor, i.e., Constraint::optional_delta_error calls.
+			ValueSelection, //!< Selecting the new value or the variable to swap with, including Objective::expert_heuristic_value.
+			ObjectiveEvaluation, //!< Computing the optimization cost of moves, with Objective::optional_delta_cost or Objective::required_cost.
+			ErrorUpdate, //!< Updating constraint errors, data structures and projected variable errors after a move.
+			AuxiliaryDataUpdate, //!< Updating auxiliary data after a move.
+			Reset, //!< Resets and restarts.
+			NumberPhases
+		};
+
+		//! Number of buckets of the iteration latency histogram.
+		static constexpr int number_latency_buckets = 40;
+
+		std::array<std::int64_t, NumberPhases> time; //!< time[ p ] is the time spent in phase p, in nanoseconds.
+		std::array<std::int64_t, NumberPhases> calls; //!< calls[ p ] is the number of times phase p has been run.
+		std::array<std::int64_t, number_latency_buckets> iteration_latency; //!< iteration_latency[ b ] is the number of iterations which took between 2^b and 2^(b+1) nanoseconds.
+		std::int64_t iterations; //!< Number of profiled iterations.
+		std::int64_t iterations_time; //!< Time spent in profiled iterations, in nanoseconds.
+
+		//! Unique constructor
+		SearchProfile()
+			: iterations( 0 ),
+			  iterations_time( 0 )
+		{
+			time.fill( 0 );
+			calls.fill( 0 );
+			iteration_latency.fill( 0 );
+		}
+
+		//! Add a duration to a phase.
+		inline void add( Phase phase, std::chrono::steady_clock::duration duration )
+		{
+			time[ phase ] += std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count();
+			++calls[ phase ];
+		}
+
+		//! Add the duration of an iteration to the latency histogram.
+		inline void add_iteration( std::chrono::steady_clock::duration duration )
+		{
+			std::int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count();
+			int bucket = 0;
+			while( bucket + 1 < number_latency_buckets && ( nanoseconds >> ( bucket + 1 ) ) > 0 )
+				++bucket;
+
+			++iteration_latency[ bucket ];
+			++iterations;
+			iterations_time += nanoseconds;
+		}
+
+		//! Sum another profile into this one, to aggregate profiles of several search units.
+		SearchProfile& operator+=( const SearchProfile& other )
+		{
+			for( int phase = 0 ; phase < NumberPhases ; ++phase )
+			{
+				time[ phase ] += other.time[ phase ];
+				calls[ phase ] += other.calls[ phase ];
+			}
+
+			for( int bucket = 0 ; bucket < number_latency_buckets ; ++bucket )
+				iteration_latency[ bucket ] += other.iteration_latency[ bucket ];
+
+			iterations += other.iterations;
+			iterations_time += other.iterations_time;
+			return *this;
+		}
+
+		//! Name of a phase.
+		static const char* phase_name( int phase )
+		{
+			static const char* names[ NumberPhases ] = { "Candidate computation",
+			                                             "Variable selection",
+			                                             "Delta evaluation",
+			                                             "Value selection",
+			                                             "Objective evaluation",
+			                                             "Error update",
+			                                             "Auxiliary data update",
+			                                             "Reset" };
+			return names[ phase ];
+		}
+
+		//! To print a profile: time, share of iterations time and mean time per call of each phase, then the latency histogram.
+		friend std::ostream& operator<<( std::ostream& os, const SearchProfile& profile )
+		{
+			auto flags = os.flags();
+			auto precision = os.precision();
+
+			os << "Profiled iterations: " << profile.iterations << " (" << profile.iterations_time / 1000 << "us)\n";
+			for( int phase = 0 ; phase < NumberPhases ; ++phase )
+			{
+				os << std::left << std::setw( 24 ) << phase_name( phase ) << std::right
+				   << std::setw( 14 ) << profile.time[ phase ] / 1000 << "us"
+				   << std::setw( 8 ) << std::fixed << std::setprecision( 1 )
+				   << ( profile.iterations_time > 0 ? 100.0 * profile.time[ phase ] / profile.iterations_time : 0.0 ) << "%"
+				   << std::setw( 12 ) << profile.calls[ phase ] << " calls"
+				   << std::setw( 12 ) << ( profile.calls[ phase ] > 0 ? profile.time[ phase ] / profile.calls[ phase ] : 0 ) << "ns/call\n";
+			}
+
+			os << "Iteration latency histogram:\n";
+			for( int bucket = 0 ; bucket < number_latency_buckets ; ++bucket )
+				if( profile.iteration_latency[ bucket ] > 0 )
+					os << "  [" << ( std::int64_t( 1 ) << bucket ) << "ns, " << ( std::int64_t( 1 ) << ( bucket + 1 ) ) << "ns[: "
+					   << profile.iteration_latency[ bucket ] << "\n";
+
+			os.flags( flags );
+			os.precision( precision );
+			return os;
+		}
+
+		//! Times the enclosing scope, and adds it to the iteration latency histogram when destroyed.
+		class IterationTimer
+		{
+			SearchProfile& _profile;
+			std::chrono::steady_clock::time_point _start;
+
+		public:
+			IterationTimer( SearchProfile& profile )
+				: _profile( profile ),
+				  _start( std::chrono::steady_clock::now() )
+			{ }
+
+			~IterationTimer() { _profile.add_iteration( std::chrono::steady_clock::now() - _start ); }
+		};
+	};
+}
@@ -49,6 +49,7 @@
 #include "search_unit_data.hpp"
 #include "model.hpp"
 #include "options.hpp"
+#include "trajectory_recorder.hpp"
 #include "thirdparty/randutils.hpp"
 
 #include "algorithms/variable_heuristic.hpp"
@@ -89,6 +90,7 @@ namespace ghost
 		std::promise<void> _stop_search_signal;
 		std::future<void> _stop_search_check;
 		std::thread::id _thread_id;
+		std::vector<bool> _contiguous_domains; // _contiguous_domains[i] is true iff the domain of the i-th variable has no holes and no duplicates.
 
 #if defined GHOST_TRACE_PARALLEL
 		std::stringstream _log_filename;
@@ -211,6 +213,32 @@ namespace ghost
 				model.variables[ variables_index[ i ] ].pick_random_value( rng );
 		}
 
+		// True iff value belongs to the domain of the variable, without copying its domain.
+		// This is O(1) for contiguous domains, the most common case.
+		bool is_in_domain( int variable_id, int value ) const
+		{
+			const auto& variable = model.variables[ variable_id ];
+			if( value < variable._min_value || value > variable._max_value )
+				return false;
+
+			if( _contiguous_domains[ variable_id ] )
+				return true;
+
+			return std::find( variable._domain.begin(), variable._domain.end(), value ) != variable._domain.end();
+		}
+
+		// A domain is contiguous if it contains each integer from its min to its max value exactly once.
+		// Its size alone is not enough to decide it, since user-given domains may contain duplicates.
+		static bool is_contiguous( const Variable& variable )
+		{
+			if( static_cast<int>( variable._domain.size() ) != variable._max_value - variable._min_value + 1 )
+				return false;
+
+			std::vector<int> sorted_domain( variable._domain );
+			std::sort( sorted_domain.begin(), sorted_domain.end() );
+			return std::adjacent_find( sorted_domain.begin(), sorted_domain.end() ) == sorted_domain.end();
+		}
+
 		// Sample an configuration for permutation problems
 		void random_permutations( int nb_var = -1 )
 		{
@@ -223,12 +251,8 @@ namespace ghost
 						if( rng.uniform( 0, 1 ) == 0
 						    && i != j
 						    && model.variables[ i ].get_value() != model.variables[ j ].get_value()
-						    && std::find( model.variables[ j ].get_full_domain().begin(),
-						                  model.variables[ j ].get_full_domain().end(),
-						                  model.variables[ i ].get_value() ) != model.variables[ j ].get_full_domain().end()
-						    && std::find( model.variables[ i ].get_full_domain().begin(),
-						                  model.variables[ i ].get_full_domain().end(),
-						                  model.variables[ j ].get_value() ) != model.variables[ i ].get_full_domain().end() )
+						    && is_in_domain( j, model.variables[ i ].get_value() )
+						    && is_in_domain( i, model.variables[ j ].get_value() ) )
 						{
 							std::swap( model.variables[i]._current_value, model.variables[j]._current_value );
 						}
@@ -246,12 +270,8 @@ namespace ghost
 				for( int i = 0 ; i < nb_var ; ++i )
 					if( variables_index_A[i] != variables_index_B[i]
 					    && model.variables[ variables_index_A[i] ].get_value() != model.variables[ variables_index_B[i] ].get_value()
-					    && std::find( model.variables[ variables_index_B[i] ].get_full_domain().begin(),
-					                  model.variables[ variables_index_B[i] ].get_full_domain().end(),
-					                  model.variables[ variables_index_A[i] ].get_value() ) != model.variables[ variables_index_B[i] ].get_full_domain().end()
-					    && std::find( model.variables[ variables_index_A[i] ].get_full_domain().begin(),
-					                  model.variables[ variables_index_A[i] ].get_full_domain().end(),
-					                  model.variables[ variables_index_B[i] ].get_value() ) != model.variables[ variables_index_A[i] ].get_full_domain().end() )
+					    && is_in_domain( variables_index_B[i], model.variables[ variables_index_A[i] ].get_value() )
+					    && is_in_domain( variables_index_A[i], model.variables[ variables_index_B[i] ].get_value() ) )
 						std::swap( model.variables[ variables_index_A[i] ]._current_value, model.variables[ variables_index_B[i] ]._current_value );
 			}
 		}
@@ -318,16 +338,36 @@ namespace ghost
 
 		void initialize_data_structures( Model& model )
 		{
-			// Determine if optional_delta_error has been user defined or not for each constraint
+			// Determine if optional_delta_error has been user defined or not for each constraint.
+			// The error is computed first, since delta computations can rely on data structures initialized there.
 			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
 				try
 				{
-					model.constraints[ constraint_id ]->optional_delta_error( model.constraints[ constraint_id ]->_variables, std::vector<int>{0}, std::vector<int>{model.variables[0].get_value()} );
+					auto& constraint = model.constraints[ constraint_id ];
+					constraint->error();
+					constraint->optional_delta_error( constraint->_variables, std::vector<int>{0}, std::vector<int>{constraint->_variables[0]->get_value()} );
 				}
 				catch( const std::exception& e )
 				{
 					std::cerr << "No optional_delta_error method defined for constraint num. " << constraint_id << "\n";
 				}
+
+			// Determine if optional_delta_cost has been user defined or not for the objective function
+			if( data.is_optimization )
+				try
+				{
+					model.objective->cost();
+					model.objective->optional_delta_cost( model.objective->_variables, std::vector<int>{0}, std::vector<int>{model.objective->_variables[0]->get_value()} );
+				}
+				catch( const std::exception& e ) { }
+
+			// Determine if optional_variable_error has been user defined or not for each constraint
+			for( int constraint_id = 0; constraint_id < data.number_constraints; ++constraint_id )
+				try
+				{
+					model.constraints[ constraint_id ]->variable_error( model.constraints[ constraint_id ]->_variables_index[0] );
+				}
+				catch( const Constraint::variableErrorNotDefinedException& e ) { }
 		}
 
 		void reset()
@@ -335,7 +375,8 @@ namespace ghost
 			++data.resets;
 
 			// if we reach the restart threshold, do a restart instead of a reset
-			if( options.restart_threshold > 0 && ( data.resets % options.restart_threshold == 0 ) )
+			bool is_restart = options.restart_threshold > 0 && ( data.resets % options.restart_threshold == 0 );
+			if( is_restart )
 			{
 				++data.restarts;
 
@@ -364,6 +405,13 @@ namespace ghost
 			}
 			
 			initialize_data_structures();
+
+#if defined GHOST_RECORD
+			if( is_restart )
+				GHOST_RECORD_EVENT( Restart, -1, data.restarts, 0.0, data.current_sat_error );
+			else
+				GHOST_RECORD_EVENT( Reset, -1, data.resets, 0.0, data.current_sat_error );
+#endif
 		}
 
 #if defined GHOST_FITNESS_CLOUD
@@ -381,12 +429,8 @@ namespace ghost
 				for( int variable_id = 0 ; variable_id < data.number_variables - 1 ; ++variable_id )
 					for( int variable_swap = variable_id + 1 ; variable_swap < data.number_variables ; ++variable_swap )
 						if( model.variables[ variable_id ].get_value() != model.variables[ variable_swap ].get_value()
-						    && std::find( model.variables[ variable_id ].get_full_domain().begin(),
-						                  model.variables[ variable_id ].get_full_domain().end(),
-						                  model.variables[ variable_swap ].get_value() ) != model.variables[ variable_id ].get_full_domain().end()
-						    && std::find( model.variables[ variable_swap ].get_full_domain().begin(),
-						                  model.variables[ variable_swap ].get_full_domain().end(),
-						                  model.variables[ variable_id ].get_value() ) != model.variables[ variable_swap ].get_full_domain().end() )
+						    && is_in_domain( variable_id, model.variables[ variable_swap ].get_value() )
+						    && is_in_domain( variable_swap, model.variables[ variable_id ].get_value() ) )
 						{
 							error = data.current_sat_error;
 							std::vector<bool> constraint_checked( data.number_constraints, false );
@@ -446,6 +490,22 @@ namespace ghost
 			return satisfaction_error;
 		}
 
+		// Project the error delta of a constraint onto its variables, unless the constraint projects its error by itself.
+		void project_error( const std::shared_ptr<Constraint>& constraint, double delta )
+		{
+			if( !constraint->is_optional_variable_error_defined() )
+				error_projection_algorithm->update_variable_errors( model.variables, constraint, data, delta );
+		}
+
+		// Update constraint data structures when variable_id takes new_value, as well as errors projected by the constraint itself.
+		void update_constraint( const std::shared_ptr<Constraint>& constraint, int variable_id, int new_value )
+		{
+			if( constraint->is_optional_variable_error_defined() )
+				error_projection_algorithm->update_projected_variable_errors( constraint, data, variable_id, new_value );
+
+			constraint->update( variable_id, new_value );
+		}
+
 		void update_errors( int variable_to_change, int new_value, const std::map< int, std::vector<double>>& delta_errors )
 		{
 			int delta_index = 0;
@@ -456,12 +516,9 @@ namespace ghost
 					auto delta = delta_errors.at( new_value )[ delta_index++ ];
 					model.constraints[ constraint_id ]->_current_error += delta;
 					
-					error_projection_algorithm->update_variable_errors( model.variables,
-					                                                    model.constraints[ constraint_id ],
-					                                                    data,
-					                                                    delta );
+					project_error( model.constraints[ constraint_id ], delta );
 
-					model.constraints[ constraint_id ]->update( variable_to_change, new_value );
+					update_constraint( model.constraints[ constraint_id ], variable_to_change, new_value );
 				}
 
 				if( data.is_optimization )
@@ -473,37 +530,40 @@ namespace ghost
 				int current_value = model.variables[ variable_to_change ].get_value();
 				int next_value = model.variables[ new_value ].get_value();
 
-				for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+				for( const int constraint_id : data.matrix_var_swap_ctr.at( variable_to_change ) )
 				{
 					constraint_checked[ constraint_id ] = true;
 					auto delta = delta_errors.at( new_value )[ delta_index++ ];
 					model.constraints[ constraint_id ]->_current_error += delta;
 
-					error_projection_algorithm->update_variable_errors( model.variables,
-					                                                    model.constraints[ constraint_id ],
-					                                                    data,
-					                                                    delta );
+					project_error( model.constraints[ constraint_id ], delta );
 					
-					model.constraints[ constraint_id ]->update( variable_to_change, next_value );
+					update_constraint( model.constraints[ constraint_id ], variable_to_change, next_value );
 
 					if( model.constraints[ constraint_id ]->has_variable( new_value ) )
-						model.constraints[ constraint_id ]->update( new_value, current_value );
+						update_constraint( model.constraints[ constraint_id ], new_value, current_value );
 				}
 
-				for( const int constraint_id : data.matrix_var_ctr.at( new_value ) )
+				for( const int constraint_id : data.matrix_var_swap_ctr.at( new_value ) )
 					if( !constraint_checked[ constraint_id ] )
 					{
 						auto delta = delta_errors.at( new_value )[ delta_index++ ];
 						model.constraints[ constraint_id ]->_current_error += delta;
 
-						error_projection_algorithm->update_variable_errors( model.variables,
-						                                                    model.constraints[ constraint_id ],
-						                                                    data,
-						                                                    delta );
+						project_error( model.constraints[ constraint_id ], delta );
 						
-						model.constraints[ constraint_id ]->update( new_value, current_value );
+						update_constraint( model.constraints[ constraint_id ], new_value, current_value );
 					}
 
+				// Swap-invariant constraints keep the same error, but their data structures must follow the swap
+				for( const int constraint_id : data.swap_invariant_constraints )
+				{
+					project_error( model.constraints[ constraint_id ], 0.0 );
+
+					update_constraint( model.constraints[ constraint_id ], variable_to_change, next_value );
+					update_constraint( model.constraints[ constraint_id ], new_value, current_value );
+				}
+
 				if( data.is_optimization )
 				{
 					model.objective->update( variable_to_change, next_value );
@@ -512,16 +572,73 @@ namespace ghost
 			}
 		}
 
+		// True if the current optimization cost is known and can be updated through objective delta costs.
+		inline bool is_optimization_cost_incremental() const
+		{
+			return data.is_optimization
+				&& model.objective->is_optional_delta_cost_defined()
+				&& data.current_opt_cost != std::numeric_limits<double>::max();
+		}
+
+		// Objective cost delta of assigning new_value to variable_to_change, or of swapping the values of
+		// variable_to_change and new_value for permutation problems, without assigning variables.
+		double delta_optimization_cost( int variable_to_change, int new_value ) const
+		{
+			if( model.permutation_problem )
+				return model.objective->simulate_delta_cost( std::vector<int>{ variable_to_change, new_value },
+				                                             std::vector<int>{ model.variables[ new_value ].get_value(), model.variables[ variable_to_change ].get_value() } );
+			else
+				return model.objective->simulate_delta_cost( std::vector<int>{ variable_to_change }, std::vector<int>{ new_value } );
+		}
+
+		// Record the current configuration as the best one found so far, if it improves the optimization cost.
+		// Costs updated through delta costs accumulate floating-point drift, so the exact cost is recomputed first.
+		void record_best_optimization_cost()
+		{
+			if( model.objective->is_optional_delta_cost_defined() )
+			{
+				GHOST_PROFILE_START( ObjectiveEvaluation );
+				data.current_opt_cost = model.objective->cost();
+				GHOST_PROFILE_STOP( ObjectiveEvaluation );
+
+				if( data.best_opt_cost <= data.current_opt_cost )
+					return;
+			}
+
+#if defined GHOST_TRACE
+			COUT << "Best objective function value so far. Before: " << data.best_opt_cost << ", now: " << data.current_opt_cost << "\n";
+#endif
+			data.best_opt_cost = data.current_opt_cost;
+			// Costs are recorded with the user's sign, like in search statistics.
+			GHOST_RECORD_EVENT( BestOptimizationCost, -1, -1, 0.0, model.objective->is_maximization() ? -data.best_opt_cost : data.best_opt_cost );
+			std::transform( model.variables.begin(),
+			                model.variables.end(),
+			                final_solution.begin(),
+			                [&](auto& var){ return var.get_value(); } );
+		}
+
 		// A. Local move (perform local move and update variables/constraints/objective function)
-		void local_move( int variable_to_change, int new_value, double min_conflict, const std::map< int, std::vector<double>>& delta_errors )
+		// Return true iff the current optimization cost has been updated incrementally.
+		bool local_move( int variable_to_change, int new_value, double min_conflict, const std::map< int, std::vector<double>>& delta_errors )
 		{
 			++data.local_moves;
 			data.current_sat_error += min_conflict;
 			data.tabu_list[ variable_to_change ] = options.tabu_time_selected + data.local_moves;
 			must_compute_variable_candidates = true;
 
+			bool is_cost_updated = is_optimization_cost_incremental();
+			if( is_cost_updated )
+			{
+				GHOST_PROFILE_START( ObjectiveEvaluation );
+				data.current_opt_cost += delta_optimization_cost( variable_to_change, new_value );
+				GHOST_PROFILE_STOP( ObjectiveEvaluation );
+			}
+
+			GHOST_PROFILE_START( ErrorUpdate );
 			update_errors( variable_to_change, new_value, delta_errors );
+			GHOST_PROFILE_STOP( ErrorUpdate );
 
+			GHOST_PROFILE_START( AuxiliaryDataUpdate );
 			if( model.permutation_problem )
 			{
 				int current_value = model.variables[ variable_to_change ].get_value();
@@ -538,6 +655,9 @@ namespace ghost
 				model.variables[ variable_to_change ].set_value( new_value );
 				model.auxiliary_data->update( variable_to_change, new_value );
 			}
+			GHOST_PROFILE_STOP( AuxiliaryDataUpdate );
+
+			return is_cost_updated;
 		}
 
 		// B. Plateau management (local move on the plateau, but options.percent_chance_force_trying_on_plateau
@@ -549,6 +669,7 @@ namespace ghost
 				data.tabu_list[ variable_to_change ] = options.tabu_time_local_min + data.local_moves;
 				must_compute_variable_candidates = true;
 				++data.plateau_force_trying_another_variable;
+				GHOST_RECORD_EVENT( PlateauEscape, variable_to_change, new_value, 0.0, data.current_sat_error );
 #if defined GHOST_TRACE
 				COUT << "Force the exploration of another variable on a plateau; current variable marked as tabu.\n";
 #endif
@@ -557,6 +678,7 @@ namespace ghost
 			{
 				local_move( variable_to_change, new_value, 0, delta_errors );
 				++data.plateau_moves;
+				GHOST_RECORD_EVENT( PlateauMove, variable_to_change, new_value, 0.0, data.current_sat_error );
 			}
 		}
 
@@ -571,6 +693,7 @@ namespace ghost
 				data.tabu_list[ variable_to_change ] = options.tabu_time_local_min + data.local_moves;
 				// must_compute_variable_candidates = true;
 				++data.local_minimum;
+				GHOST_RECORD_EVENT( LocalMinimum, variable_to_change, new_value, 0.0, data.current_sat_error );
 			}
 			else
 			{
@@ -602,6 +725,8 @@ namespace ghost
 
 		Options options;
 
+		TrajectoryBuffer* trajectory; // Where to record the search trajectory if GHOST_RECORD is defined; nothing is recorded if null.
+
 		SearchUnit( Model&& moved_model,
 		            const Options& options,
 		            std::unique_ptr<algorithms::VariableHeuristic> variable_heuristic,
@@ -618,13 +743,19 @@ namespace ghost
 			  final_solution( std::vector<int>( data.number_variables, 0 ) ),
 			  variable_candidates(), 
 			  must_compute_variable_candidates ( true ),
-			  options ( options )
+			  options ( options ),
+			  trajectory( nullptr )
 		{
 			std::transform( model.variables.begin(),
 			                model.variables.end(),
 			                std::back_inserter( variables_at_start ),
 			                [&]( auto& v){ return v; } );
 
+			std::transform( model.variables.begin(),
+			                model.variables.end(),
+			                std::back_inserter( _contiguous_domains ),
+			                [&]( const auto& v ){ return is_contiguous( v ); } );
+
 			initialize_data_structures( model );
 			data.initialize_matrix( model );
 			this->error_projection_algorithm->initialize_data_structures( data );
@@ -729,6 +860,7 @@ namespace ghost
 			       &&  elapsed_time.count() < timeout
 			       && ( data.best_sat_error > 0.0 || ( data.best_sat_error == 0.0 && data.is_optimization ) ) )
 			{
+				GHOST_PROFILE_ITERATION();
 				++data.search_iterations;
 				
 #if defined GHOST_FITNESS_CLOUD
@@ -747,7 +879,16 @@ namespace ghost
 
 				// Estimate which variables need to be changed
 				if( must_compute_variable_candidates )
+				{
+					GHOST_PROFILE_START( CandidateComputation );
+					if( data.is_optimization && data.current_sat_error == 0 )
+						data.critical_variables = model.objective->critical_variables();
+					else
+						data.critical_variables.clear();
+
 					variable_candidates = variable_candidates_heuristic->compute_variable_candidates( data );
+					GHOST_PROFILE_STOP( CandidateComputation );
+				}
 
 #if defined GHOST_TRACE
 				if( std::count_if( data.tabu_list.begin(),
@@ -766,7 +907,9 @@ namespace ghost
 #if defined GHOST_TRACE
 					COUT << "No variables left to be changed: reset.\n";
 #endif
+					GHOST_PROFILE_START( Reset );
 					reset();
+					GHOST_PROFILE_STOP( Reset );
 					continue;
 				}
 
@@ -803,7 +946,10 @@ namespace ghost
 						}
 #endif
 
+				GHOST_PROFILE_START( VariableSelection );
 				variable_to_change = variable_heuristic->select_variable( variable_candidates, data, rng );
+				GHOST_PROFILE_STOP( VariableSelection );
+				GHOST_RECORD_EVENT( VariableSelected, variable_to_change, model.variables[ variable_to_change ].get_value(), 0.0, data.current_sat_error );
 
 #if defined GHOST_TRACE  && not defined GHOST_FITNESS_CLOUD
 				COUT << options.print->print_candidate( model.variables ).str();
@@ -822,6 +968,7 @@ namespace ghost
 				/********************************
 				 * 2. Choice of their new value *
 				 ********************************/
+				GHOST_PROFILE_START( DeltaEvaluation );
 				// Can we erase an element by "mistake" if we use the Antidote's variable heuristic? Is it a big deal?
 				auto ref = std::find( variable_candidates.begin(), variable_candidates.end(), static_cast<double>( variable_to_change ) );
 				if( ref != variable_candidates.end() )
@@ -854,17 +1001,15 @@ namespace ghost
 						// look at other variables than the selected one, with other values but contained into the selected variable's domain
 						if( variable_id != variable_to_change
 						    && model.variables[ variable_id ].get_value() != model.variables[ variable_to_change ].get_value()
-						    && std::find( domain_to_explore.begin(), domain_to_explore.end(), model.variables[ variable_id ].get_value() ) != domain_to_explore.end()
-						    && std::find( model.variables[ variable_id ].get_full_domain().begin(),
-						                  model.variables[ variable_id ].get_full_domain().end(),
-						                  model.variables[ variable_to_change ].get_value() ) != model.variables[ variable_id ].get_full_domain().end() )
+						    && is_in_domain( variable_to_change, model.variables[ variable_id ].get_value() )
+						    && is_in_domain( variable_id, model.variables[ variable_to_change ].get_value() ) )
 						{
 							std::vector<bool> constraint_checked( data.number_constraints, false );
 							int current_value = model.variables[ variable_to_change ].get_value();
 							int candidate_value = model.variables[ variable_id ].get_value();
 
-							delta_errors[ variable_id ].reserve( data.matrix_var_ctr.at( variable_to_change ).size() + data.matrix_var_ctr.at( variable_id ).size() );
-							for( const int constraint_id : data.matrix_var_ctr.at( variable_to_change ) )
+							delta_errors[ variable_id ].reserve( data.matrix_var_swap_ctr.at( variable_to_change ).size() + data.matrix_var_swap_ctr.at( variable_id ).size() );
+							for( const int constraint_id : data.matrix_var_swap_ctr.at( variable_to_change ) )
 							{
 								constraint_checked[ constraint_id ] = true;
 
@@ -878,7 +1023,7 @@ namespace ghost
 							}
 
 							// Since we are switching the value of two variables, we need to also look at the delta error impact of changing the value of the non-selected variable
-							for( const int constraint_id : data.matrix_var_ctr.at( variable_id ) )
+							for( const int constraint_id : data.matrix_var_swap_ctr.at( variable_id ) )
 								// No need to look at constraint where variable_to_change also appears.
 								if( !constraint_checked[ constraint_id ] )
 									delta_errors[ variable_id ].push_back( model.constraints[ constraint_id ]->simulate_delta( std::vector<int>{variable_id},
@@ -886,9 +1031,14 @@ namespace ghost
 						}
 				}
 
+				GHOST_PROFILE_STOP( DeltaEvaluation );
+
 				// Select the next current configuration (local move)
+				GHOST_PROFILE_START( ValueSelection );
 				double min_conflict = std::numeric_limits<double>::max();
 				int new_value = value_heuristic->select_value( variable_to_change, data, model, delta_errors, min_conflict, rng );
+				GHOST_PROFILE_STOP( ValueSelection );
+				GHOST_RECORD_EVENT( ValueSelected, variable_to_change, new_value, min_conflict, data.current_sat_error );
 				
 #if defined GHOST_TRACE && not defined GHOST_FITNESS_CLOUD
 				std::vector<int> candidate_values;
@@ -1005,15 +1155,20 @@ namespace ghost
 #endif // GHOST_TRACE
 
 #if defined GHOST_RANDOM_WALK
-				local_move( variable_to_change, new_value, min_conflict, delta_errors );
-				if( data.is_optimization )
+				if( !local_move( variable_to_change, new_value, min_conflict, delta_errors ) && data.is_optimization )
+				{
+					GHOST_PROFILE_START( ObjectiveEvaluation );
 					data.current_opt_cost = model.objective->cost();
+					GHOST_PROFILE_STOP( ObjectiveEvaluation );
+				}
+				GHOST_RECORD_EVENT( LocalMove, variable_to_change, new_value, min_conflict, data.current_sat_error );
 				if( data.best_sat_error > data.current_sat_error )
 				{
 #if defined GHOST_TRACE
 					COUT << "Best satisfaction error so far (in an optimization problem). Before: " << data.best_sat_error << ", now: " << data.current_sat_error << "\n";
 #endif
 					data.best_sat_error = data.current_sat_error;
+					GHOST_RECORD_EVENT( BestSatisfactionError, -1, -1, 0.0, data.best_sat_error );
 					std::transform( model.variables.begin(),
 					                model.variables.end(),
 					                final_solution.begin(),
@@ -1021,16 +1176,7 @@ namespace ghost
 				}
 				else
 					if( data.is_optimization && data.current_sat_error == 0.0 && data.best_opt_cost > data.current_opt_cost )
-					{
-#if defined GHOST_TRACE
-						COUT << "Best objective function value so far. Before: " << data.best_opt_cost << ", now: " << data.current_opt_cost << "\n";
-#endif
-						data.best_opt_cost = data.current_opt_cost;
-						std::transform( model.variables.begin(),
-						                model.variables.end(),
-						                final_solution.begin(),
-						                [&](auto& var){ return var.get_value(); } );
-					}
+						record_best_optimization_cost();
 
 				elapsed_time = std::chrono::steady_clock::now() - start;
 				continue;				
@@ -1044,9 +1190,13 @@ namespace ghost
 #if defined GHOST_TRACE
 					COUT << "Global error improved (" << data.current_sat_error << " -> " << data.current_sat_error + min_conflict << "): make local move.\n";
 #endif
-					local_move( variable_to_change, new_value, min_conflict, delta_errors );
-					if( data.is_optimization )
+					if( !local_move( variable_to_change, new_value, min_conflict, delta_errors ) && data.is_optimization )
+					{
+						GHOST_PROFILE_START( ObjectiveEvaluation );
 						data.current_opt_cost = model.objective->cost();
+						GHOST_PROFILE_STOP( ObjectiveEvaluation );
+					}
+					GHOST_RECORD_EVENT( LocalMove, variable_to_change, new_value, min_conflict, data.current_sat_error );
 				}
 				else
 				{
@@ -1060,38 +1210,43 @@ namespace ghost
 #endif
 						if( data.is_optimization && options.enable_optimization_guidance )
 						{
+							GHOST_PROFILE_START( ObjectiveEvaluation );
 							double candidate_opt_cost;
-							if( model.permutation_problem )
-							{
-								int backup_variable_to_change = model.variables[ variable_to_change ].get_value();
-								int backup_variable_new_value = model.variables[ new_value ].get_value();
+							if( is_optimization_cost_incremental() )
+								candidate_opt_cost = data.current_opt_cost + delta_optimization_cost( variable_to_change, new_value );
+							else
+								if( model.permutation_problem )
+								{
+									int backup_variable_to_change = model.variables[ variable_to_change ].get_value();
+									int backup_variable_new_value = model.variables[ new_value ].get_value();
 
-								model.variables[ variable_to_change ].set_value( backup_variable_new_value );
-								model.variables[ new_value ].set_value( backup_variable_to_change );
+									model.variables[ variable_to_change ].set_value( backup_variable_new_value );
+									model.variables[ new_value ].set_value( backup_variable_to_change );
 
-								model.auxiliary_data->update( variable_to_change, backup_variable_new_value );
-								model.auxiliary_data->update( new_value, backup_variable_to_change );
+									model.auxiliary_data->update( variable_to_change, backup_variable_new_value );
+									model.auxiliary_data->update( new_value, backup_variable_to_change );
 
-								candidate_opt_cost = model.objective->cost();
+									candidate_opt_cost = model.objective->cost();
 
-								model.variables[ variable_to_change ].set_value( backup_variable_to_change );
-								model.variables[ new_value ].set_value( backup_variable_new_value );
+									model.variables[ variable_to_change ].set_value( backup_variable_to_change );
+									model.variables[ new_value ].set_value( backup_variable_new_value );
 
-								model.auxiliary_data->update( variable_to_change, backup_variable_to_change );
-								model.auxiliary_data->update( new_value, backup_variable_new_value );
-							}
-							else
-							{
-								int backup = model.variables[ variable_to_change ].get_value();
+									model.auxiliary_data->update( variable_to_change, backup_variable_to_change );
+									model.auxiliary_data->update( new_value, backup_variable_new_value );
+								}
+								else
+								{
+									int backup = model.variables[ variable_to_change ].get_value();
 
-								model.variables[ variable_to_change ].set_value( new_value );
-								model.auxiliary_data->update( variable_to_change, new_value );
+									model.variables[ variable_to_change ].set_value( new_value );
+									model.auxiliary_data->update( variable_to_change, new_value );
 
-								candidate_opt_cost = model.objective->cost();
+									candidate_opt_cost = model.objective->cost();
 
-								model.variables[ variable_to_change ].set_value( backup );
-								model.auxiliary_data->update( variable_to_change, backup );
-							}
+									model.variables[ variable_to_change ].set_value( backup );
+									model.auxiliary_data->update( variable_to_change, backup );
+								}
+							GHOST_PROFILE_STOP( ObjectiveEvaluation );
 
 							/******************************************************
 							 * 4.a. Optimization cost improved => make local move *
@@ -1103,6 +1258,7 @@ namespace ghost
 #endif
 								local_move( variable_to_change, new_value, min_conflict, delta_errors );
 								data.current_opt_cost = candidate_opt_cost;
+								GHOST_RECORD_EVENT( LocalMove, variable_to_change, new_value, min_conflict, data.current_sat_error );
 							}
 							else
 								/******************************************
@@ -1169,6 +1325,7 @@ namespace ghost
 					COUT << "Best satisfaction error so far (in an optimization problem). Before: " << data.best_sat_error << ", now: " << data.current_sat_error << "\n";
 #endif
 					data.best_sat_error = data.current_sat_error;
+					GHOST_RECORD_EVENT( BestSatisfactionError, -1, -1, 0.0, data.best_sat_error );
 					std::transform( model.variables.begin(),
 					                model.variables.end(),
 					                final_solution.begin(),
@@ -1176,16 +1333,7 @@ namespace ghost
 				}
 				else
 					if( data.is_optimization && data.current_sat_error == 0.0 && data.best_opt_cost > data.current_opt_cost )
-					{
-#if defined GHOST_TRACE
-						COUT << "Best objective function value so far. Before: " << data.best_opt_cost << ", now: " << data.current_opt_cost << "\n";
-#endif
-						data.best_opt_cost = data.current_opt_cost;
-						std::transform( model.variables.begin(),
-						                model.variables.end(),
-						                final_solution.begin(),
-						                [&](auto& var){ return var.get_value(); } );
-					}
+						record_best_optimization_cost();
 
 				elapsed_time = std::chrono::steady_clock::now() - start;
 			} // while loop
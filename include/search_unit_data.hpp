@@ -32,8 +32,10 @@
 
 #include <vector>
 #include <algorithm>
+#include <iterator>
 
 #include "model.hpp"
+#include "search_profile.hpp"
 
 namespace ghost
 {
@@ -51,13 +53,25 @@ namespace ghost
 		// matrix_var_ctr[ variable_id ] = { constraint_id_1, ..., constraint_id_k }
 		std::vector<std::vector<int> > matrix_var_ctr;
 
+		// In permutation problems, constraints whose delta errors must be simulated when swapping values of a given variable.
+		// It is matrix_var_ctr without swap-invariant constraints containing all variables that can be swapped, since their
+		// error cannot change. These constraints are listed in swap_invariant_constraints, to keep their data structures updated.
+		std::vector<std::vector<int> > matrix_var_swap_ctr;
+		std::vector<int> swap_invariant_constraints;
+
 		// To know how many iterations each variable is still marked as tabu
 		// tabu_list[2] = 3 --> variable with id=2 is marked tabu for the next 3 iterations of the search process
 		// tabu_list[6] = 0 --> variable with id=6 is not marked as tabu (therefore, it is selectable during the search process)
 		std::vector<int> tabu_list;
 
+		// Variables with a singleton domain cannot change their value, and are never selected during the search process.
+		// fixed_variables[2] = true --> variable with id=2 has a singleton domain
+		std::vector<bool> fixed_variables;
+
 		// Variables about errors of the variables, and global satisfaction/optimization errors
 		std::vector<double> error_variables;
+		// Variables the objective cost currently depends on, once constraints are satisfied. Empty if unknown.
+		std::vector<int> critical_variables;
 		double best_sat_error;
 		double best_opt_cost;
 		double current_sat_error;
@@ -72,12 +86,17 @@ namespace ghost
 		int plateau_moves;
 		int plateau_force_trying_another_variable;
 
+		// Time spent in each phase of the search, only filled if GHOST_PROFILE is defined
+		SearchProfile profile;
+
 		SearchUnitData( const Model& model )
 		: number_variables ( static_cast<int>( model.variables.size() ) ),
 		  number_constraints ( static_cast<int>( model.constraints.size() ) ),
 		  is_optimization ( model.objective->is_optimization() ),
 		  matrix_var_ctr ( number_variables ),
+		  matrix_var_swap_ctr ( number_variables ),
 		  tabu_list ( std::vector<int>( number_variables, 0 ) ),
+		  fixed_variables ( std::vector<bool>( number_variables, false ) ),
 		  error_variables ( std::vector<double>( number_variables, 0.0 ) ),
 		  best_sat_error ( std::numeric_limits<double>::max() ),
 		  best_opt_cost ( std::numeric_limits<double>::max() ),
@@ -90,7 +109,10 @@ namespace ghost
 		  local_minimum ( 0 ),
 		  plateau_moves ( 0 ),
 		  plateau_force_trying_another_variable ( 0 )
-		{ }
+		{
+			for( int variable_id = 0; variable_id < number_variables; ++variable_id )
+				fixed_variables[ variable_id ] = ( model.variables[ variable_id ].get_domain_size() == 1 );
+		}
 
 		void initialize_matrix( const Model& model )
 		{
@@ -99,6 +121,29 @@ namespace ghost
 				for( int constraint_id = 0; constraint_id < number_constraints; ++constraint_id )
 					if( model.constraints[ constraint_id ]->has_variable( variable_id ) )
 						matrix_var_ctr[ variable_id ].push_back( constraint_id );
+
+			if( !model.permutation_problem )
+				return;
+
+			for( int constraint_id = 0; constraint_id < number_constraints; ++constraint_id )
+				if( model.constraints[ constraint_id ]->optional_is_swap_invariant() )
+				{
+					bool contains_swappable_variables = true;
+					for( int variable_id = 0; variable_id < number_variables && contains_swappable_variables; ++variable_id )
+						if( !fixed_variables[ variable_id ] && !model.constraints[ constraint_id ]->has_variable( variable_id ) )
+							contains_swappable_variables = false;
+
+					if( contains_swappable_variables )
+						swap_invariant_constraints.push_back( constraint_id );
+				}
+
+			for( int variable_id = 0; variable_id < number_variables; ++variable_id )
+				std::copy_if( matrix_var_ctr[ variable_id ].begin(),
+				              matrix_var_ctr[ variable_id ].end(),
+				              std::back_inserter( matrix_var_swap_ctr[ variable_id ] ),
+				              [&]( int constraint_id ){ return std::find( swap_invariant_constraints.begin(),
+				                                                          swap_invariant_constraints.end(),
+				                                                          constraint_id ) == swap_invariant_constraints.end(); } );
 		}
 	};
 }
@@ -40,8 +40,10 @@
 #include <chrono>
 #include <memory>
 #include <iterator>
+#include <numeric>
 #include <thread>
 #include <future>
+#include <atomic>
 
 #include "variable.hpp"
 #include "constraint.hpp"
@@ -50,6 +52,9 @@
 #include "model.hpp"
 #include "model_builder.hpp"
 #include "options.hpp"
+#include "solver_statistics.hpp"
+#include "trajectory_recorder.hpp"
+#include "search_profile.hpp"
 #include "search_unit.hpp"
 
 #include "algorithms/variable_heuristic.hpp"
@@ -127,24 +132,6 @@ namespace ghost
 		double _best_opt_cost;
 		double _cost_before_postprocess;
 
-		// global statistics, cumulation of all threads stats.
-		int _restarts_total;
-		int _resets_total;
-		int _local_moves_total;
-		int _search_iterations_total;
-		int _local_minimum_total;
-		int _plateau_moves_total;
-		int _plateau_force_trying_another_variable_total;
-
-		// stats of the winning thread
-		int _restarts;
-		int _resets;
-		int _local_moves;
-		int _search_iterations;
-		int _local_minimum;
-		int _plateau_moves;
-		int _plateau_force_trying_another_variable;
-
 		std::string _variable_heuristic;
 		std::string _variable_candidates_heuristic;
 		std::string _value_heuristic;
@@ -155,6 +142,68 @@ namespace ghost
 		// matrix_var_ctr[ variable_id ] = { constraint_id_1, ..., constraint_id_k }
 		std::vector<std::vector<int> > _matrix_var_ctr;
 
+		// Connected components of the variable-constraint graph, used by complete_search.
+		// Each component is a sorted vector of variable ids.
+		std::vector<std::vector<int> > _components;
+
+		// Position of each variable in the vectors of domains given to filtering methods: its position in its
+		// component during complete_search, so that domains are only copied for the component being searched,
+		// or its id during preprocessing.
+		std::vector<int> _domain_position;
+
+		// Solutions of each component found by the last complete_search call, as values of the component's
+		// variables. Solutions of the model are combinations of them, built on demand by get_solution.
+		std::vector<std::vector<std::vector<int>>> _component_solutions;
+
+		// If the cost of a combination is a sum of terms over components, _component_costs[ c ][ s ] is the cost
+		// change when component c takes its solution s rather than its first one, and _first_solutions_cost is the
+		// cost when every component takes its first solution. Otherwise, _component_costs is empty.
+		std::vector<std::vector<double>> _component_costs;
+		double _first_solutions_cost;
+
+		// Domains filtered by preprocessing for fast_search, empty if preprocessing is disabled.
+		std::vector<std::vector<int> > _preprocessed_domains;
+
+		// Budgets and counters of a complete_search call, shared by threads searching different components.
+		struct CompleteSearchRun
+		{
+			std::chrono::time_point<std::chrono::steady_clock> start;
+			std::chrono::microseconds timeout;
+			int node_limit;
+			std::shared_ptr<std::atomic<bool>> cancel_search;
+
+			std::atomic<int> nodes;
+			std::atomic<int> fails;
+			std::atomic<int> propagations;
+			std::atomic<bool> interrupted;
+
+			CompleteSearchRun( std::chrono::microseconds timeout, const Options& options )
+				: start( std::chrono::steady_clock::now() ),
+				  timeout( timeout ),
+				  node_limit( options.node_limit ),
+				  cancel_search( options.cancel_search ),
+				  nodes( 0 ),
+				  fails( 0 ),
+				  propagations( 0 ),
+				  interrupted( false )
+			{ }
+
+			// Check budgets and cancellation before exploring a new node. Return true iff the search must stop.
+			bool must_stop()
+			{
+				if( !interrupted
+				    && ( ( node_limit > 0 && nodes >= node_limit )
+				         || ( cancel_search && *cancel_search )
+				         || std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ) >= timeout ) )
+					interrupted = true;
+
+				return interrupted;
+			}
+		};
+
+		std::vector<SearchProfile> _search_profiles; // One profile per search unit of the last fast_search call.
+		SolverStatistics _statistics; // Statistics of the last fast_search or complete_search call.
+
 		Options _options; // Options for the solver (see the struct Options).
 
 		// Prefilter domains before running the AC3 algorithm, if the model contains some unary constraints 
@@ -180,6 +229,148 @@ namespace ghost
 			}
 		}
 		
+		// Initialize data structures required by prefiltering and ac3_filtering on the current _model
+		void initialize_filtering( const std::vector< std::vector<int>>& domains )
+		{
+			_matrix_var_ctr.resize( _model.variables.size() );
+			for( int variable_id = 0; variable_id < static_cast<int>( _model.variables.size() ); ++variable_id )
+			{
+				_matrix_var_ctr[ variable_id ] = std::vector<int>();
+				for( int constraint_id = 0; constraint_id < static_cast<int>( _model.constraints.size() ); ++constraint_id )
+					if( _model.constraints[ constraint_id ]->has_variable( variable_id ) )
+						_matrix_var_ctr[ variable_id ].push_back( constraint_id );
+			}
+
+			// Determine if optional_filter_domains has been user defined or not for each constraint
+			for( auto& constraint : _model.constraints )
+				try
+				{
+					std::vector< std::vector<int>> scope_domains;
+					for( int var_index : constraint->_variables_index )
+						scope_domains.emplace_back( domains[ var_index ] );
+					constraint->optional_filter_domains( constraint->_variables, scope_domains );
+				}
+				catch( const Constraint::filterDomainsNotDefinedException& e ) { }
+		}
+
+		// Preprocessing of fast_search: node consistency, then arc consistency bounded to couples (constraint, variable)
+		// with few supports to check, over the full domains of a model built for this purpose.
+		// Filtered domains are stored in _preprocessed_domains. Return false iff some domain has been emptied,
+		// i.e., if the model is trivially unsatisfiable.
+		bool preprocess_domains()
+		{
+			// Maximal number of combinations of values to enumerate to check supports of each value
+			constexpr double max_support_checks = 1024;
+
+			_model = _model_builder.build_model();
+
+			_preprocessed_domains.clear();
+			for( auto& var : _model.variables )
+				_preprocessed_domains.emplace_back( var.get_full_domain() );
+
+			initialize_filtering( _preprocessed_domains );
+			prefiltering( _preprocessed_domains );
+
+			if( std::any_of( _preprocessed_domains.cbegin(), _preprocessed_domains.cend(), [&]( auto& domain ){ return domain.empty(); } ) )
+				return false;
+
+			_domain_position.resize( _model.variables.size() );
+			std::iota( _domain_position.begin(), _domain_position.end(), 0 );
+
+			std::deque<std::pair<int, int>> ac3queue;
+			for( auto& constraint : _model.constraints )
+				for( int variable_id : constraint->_variables_index )
+					ac3queue.push_back( std::make_pair( constraint->_id, variable_id ) );
+
+			return revise_domains( -1, _preprocessed_domains, ac3queue, max_support_checks );
+		}
+
+		// Counters of a search unit, once its search is over.
+		SearchUnitStatistics unit_statistics( const SearchUnit& unit ) const
+		{
+			SearchUnitStatistics statistics;
+			statistics.search_iterations = unit.data.search_iterations;
+			statistics.local_moves = unit.data.local_moves;
+			statistics.plateau_moves = unit.data.plateau_moves;
+			statistics.plateau_force_trying_another_variable = unit.data.plateau_force_trying_another_variable;
+			statistics.local_minimum = unit.data.local_minimum;
+			statistics.resets = unit.data.resets;
+			statistics.restarts = unit.data.restarts;
+			statistics.satisfaction_error = unit.data.best_sat_error;
+			statistics.optimization_cost = unit.data.is_optimization && unit.model.objective->is_maximization() ? -unit.data.best_opt_cost : unit.data.best_opt_cost;
+			return statistics;
+		}
+
+		// Build a model for a search unit of fast_search, with domains narrowed by preprocessing if any.
+		// Domains of permutation problems are left untouched, since swaps must keep the starting values.
+		Model build_search_model()
+		{
+			auto model = _model_builder.build_model();
+
+			if( !_preprocessed_domains.empty() && !model.permutation_problem )
+				for( int variable_id = 0 ; variable_id < static_cast<int>( model.variables.size() ) ; ++variable_id )
+					if( _preprocessed_domains[ variable_id ].size() < model.variables[ variable_id ].get_domain_size() )
+						model.variables[ variable_id ].narrow_domain( _preprocessed_domains[ variable_id ] );
+
+			return model;
+		}
+
+		// Compute connected components of the variable-constraint graph with a union-find structure.
+		// Two variables are in the same component iff they are linked by a chain of constraints.
+		void compute_components()
+		{
+			std::vector<int> parent( _model.variables.size() );
+			std::iota( parent.begin(), parent.end(), 0 );
+
+			auto find_root = [&]( int variable_id )
+			{
+				while( parent[ variable_id ] != variable_id )
+				{
+					parent[ variable_id ] = parent[ parent[ variable_id ] ];
+					variable_id = parent[ variable_id ];
+				}
+				return variable_id;
+			};
+
+			for( auto& constraint : _model.constraints )
+			{
+				int root = find_root( constraint->_variables_index[ 0 ] );
+				for( int variable_id : constraint->_variables_index )
+				{
+					int other_root = find_root( variable_id );
+					if( other_root != root )
+						parent[ other_root ] = root;
+				}
+			}
+
+			std::vector<int> component_of_root( _model.variables.size(), -1 );
+			_components.clear();
+			_domain_position.resize( _model.variables.size() );
+			for( int variable_id = 0 ; variable_id < static_cast<int>( _model.variables.size() ) ; ++variable_id )
+			{
+				int root = find_root( variable_id );
+				if( component_of_root[ root ] == -1 )
+				{
+					component_of_root[ root ] = static_cast<int>( _components.size() );
+					_components.emplace_back();
+				}
+
+				_domain_position[ variable_id ] = static_cast<int>( _components[ component_of_root[ root ] ].size() );
+				_components[ component_of_root[ root ] ].push_back( variable_id );
+			}
+		}
+
+		// Domain of a variable in a vector of domains indexed as described by _domain_position.
+		inline std::vector<int>& domain_of( std::vector< std::vector<int>>& domains, int variable_id ) const
+		{
+			return domains[ _domain_position[ variable_id ] ];
+		}
+
+		inline const std::vector<int>& domain_of( const std::vector< std::vector<int>>& domains, int variable_id ) const
+		{
+			return domains[ _domain_position[ variable_id ] ];
+		}
+
 		// AC3 algorithm for complete_search. This method is handling the filtering, and return filtered domains.
 		// The vector of vector 'domains' is passed by copy on purpose.
 		// The value of variable[ index_v ] has already been set before the call
@@ -197,14 +388,54 @@ namespace ghost
 					ac3queue.push_back( std::make_pair( constraint_id, variable_id ) );
 				}
 
+			revise_domains( index_v, domains, ac3queue );
+			return domains;
+		}
+
+		// Main loop of the AC3 algorithm, revising domains until ac3queue is empty. Only variables with an id strictly greater
+		// than index_v are considered free. Couples (constraint, variable) for which checking supports of each value would
+		// require to test more than max_support_checks combinations are skipped.
+		// Return false iff a domain has been emptied.
+		bool revise_domains( int index_v,
+		                     std::vector< std::vector<int>>& domains,
+		                     std::deque<std::pair<int, int>>& ac3queue,
+		                     double max_support_checks = std::numeric_limits<double>::max() )
+		{
 			std::vector<int> values_to_remove;
 			while( !ac3queue.empty() )
 			{
 				int constraint_id = ac3queue.front().first;
 				int variable_id = ac3queue.front().second;
 				ac3queue.pop_front();
+
+				// Constraints with their own filtering method revise all their variables at once
+				if( _model.constraints[ constraint_id ]->is_optional_filter_domains_defined() )
+				{
+					ac3queue.erase( std::remove_if( ac3queue.begin(),
+					                                ac3queue.end(),
+					                                [&]( auto& elem ){ return elem.first == constraint_id; } ),
+					                ac3queue.end() );
+
+					if( !propagate( constraint_id, variable_id, index_v, domains, ac3queue ) )
+						return false;
+
+					continue;
+				}
+
+				if( max_support_checks < std::numeric_limits<double>::max() )
+				{
+					double support_checks = 1.0;
+					for( int var_index : _model.constraints[ constraint_id ]->_variables_index )
+						if( var_index > index_v && var_index != variable_id )
+							support_checks *= domain_of( domains, var_index ).size();
+
+					if( support_checks > max_support_checks )
+						continue;
+				}
+
 				values_to_remove.clear();
-				for( auto value : domains[variable_id] )
+				auto& domain = domain_of( domains, variable_id );
+				for( auto value : domain )
 				{
 					_model.variables[variable_id].set_value( value );
 					if( !has_support( constraint_id, variable_id, value, index_v, domains ) )
@@ -232,14 +463,67 @@ namespace ghost
 				}
 
 				for( int value : values_to_remove )
-					domains[variable_id].erase( std::find( domains[variable_id].begin(), domains[variable_id].end(), value ) );
+					domain.erase( std::find( domain.begin(), domain.end(), value ) );
 
 				// once a domain is empty, no need to go further
-				if( domains[variable_id].empty() )
-					return domains;
+				if( domain.empty() )
+					return false;
 			}
 
-			return domains;
+			return true;
+		}
+
+		// Method called by ac3_filtering for constraints overriding Constraint::optional_filter_domains. Filter the domains of all
+		// free variables in the scope of constraint_id at once, and push into ac3queue couples (constraint id, variable id) to revise
+		// because of domain reductions. If the constraint cannot be satisfied, empty the domain of variable_id.
+		// Return false iff a domain has been emptied.
+		// Values of variables up to variable[ index_v ] have already been set before the call
+		bool propagate( int constraint_id, int variable_id, int index_v, std::vector< std::vector<int>>& domains, std::deque<std::pair<int, int>>& ac3queue )
+		{
+			auto& constraint = _model.constraints[ constraint_id ];
+
+			std::vector< std::vector<int>> scope_domains;
+			scope_domains.reserve( constraint->_variables_index.size() );
+			for( int var_index : constraint->_variables_index )
+				if( var_index <= index_v )
+					scope_domains.emplace_back( 1, _model.variables[ var_index ].get_value() );
+				else
+					scope_domains.emplace_back( domain_of( domains, var_index ) );
+
+			if( !constraint->filter_domains( scope_domains ) )
+			{
+				domain_of( domains, variable_id ).clear();
+				return false;
+			}
+
+			for( int i = 0 ; i < static_cast<int>( scope_domains.size() ) ; ++i )
+			{
+				int var_index = constraint->_variables_index[ i ];
+				if( var_index <= index_v || scope_domains[ i ].size() == domain_of( domains, var_index ).size() )
+					continue;
+
+				domain_of( domains, var_index ) = std::move( scope_domains[ i ] );
+				for( int c_id : _matrix_var_ctr[ var_index ] )
+				{
+					if( c_id == constraint_id )
+						continue;
+
+					for( int v_id : _model.constraints[ c_id ]->_variables_index )
+					{
+						if( v_id <= index_v || v_id == var_index )
+							continue;
+
+						if( std::find_if( ac3queue.begin(),
+						                  ac3queue.end(),
+						                  [&]( auto& elem ){ return elem.first == c_id && elem.second == v_id; } ) == ac3queue.end() )
+						{
+							ac3queue.push_back( std::make_pair( c_id, v_id ) );
+						}
+					}
+				}
+			}
+
+			return true;
 		}
 
 		// Method called by ac3_filtering, to compute if variable_id assigned to value has some support for the constraint
@@ -266,7 +550,7 @@ namespace ghost
 				for( int i = 0 ; i < fake_index ; ++i )
 				{
 					int assignment_index = constraint_scope[i];
-					int assignment_value = domains[ assignment_index ][ indexes[ i ] ];
+					int assignment_value = domain_of( domains, assignment_index )[ indexes[ i ] ];
 					_model.variables[ assignment_index ].set_value( assignment_value );
 				}
 
@@ -280,7 +564,7 @@ namespace ghost
 					{
 						changed = false;
 						++indexes[ index ];
-						if( index < fake_index && indexes[ index ] >= static_cast<int>( domains[ constraint_scope[ index ] ].size() ) )
+						if( index < fake_index && indexes[ index ] >= static_cast<int>( domain_of( domains, constraint_scope[ index ] ).size() ) )
 						{
 							indexes[ index ] = 0;
 							changed = true;
@@ -294,47 +578,59 @@ namespace ghost
 			return false;
 		}
 		
-		// Recursive call of complete_search. Search for all solutions of the problem instance.
-		// index_v is the index of the last variable assigned. Return the vector of some found solutions.
-		// The value of variable[ index_v ] has already been set before the call
-		std::vector<std::vector<int>> complete_search( int index_v, std::vector< std::vector<int>> domains )
+		// Recursive call of complete_search. Search for all solutions of the connected component 'component'.
+		// index_c is the position in component of the last variable assigned. Return the vector of some found
+		// solutions, each of them containing the values of the component's variables only.
+		// Variables of a component are sorted by id, so variables of the component assigned so far are exactly
+		// those with an id lower or equal to component[ index_c ]. This is what ac3_filtering expects.
+		// domains only contains the domains of the component's variables, see _domain_position.
+		// The value of variable[ component[ index_c ] ] has already been set before the call
+		std::vector<std::vector<int>> complete_search( const std::vector<int>& component, int index_c, std::vector< std::vector<int>> domains, CompleteSearchRun& run )
 		{
 			// should never be called
-			if( index_v >= _model.variables.size() )
+			if( index_c + 1 >= static_cast<int>( component.size() ) )
 				return std::vector<std::vector<int>>();
 
 			std::vector< std::vector<int>> new_domains;
-			if( index_v > 0 )
+			if( index_c > 0 )
 			{
-				new_domains	= ac3_filtering( index_v, domains );
+				new_domains	= ac3_filtering( component[ index_c ], std::move( domains ) );
+				++run.propagations;
 				auto empty_domain = std::find_if( new_domains.cbegin(), new_domains.cend(), [&]( auto& domain ){ return domain.empty(); } );
 
 				if( empty_domain != new_domains.cend() )
+				{
+					++run.fails;
 					return std::vector<std::vector<int>>();
+				}
 			}
 			else
 			{
-				new_domains = domains; // already filtered
+				new_domains = std::move( domains ); // already filtered
 			}
 				
-			int next_var = index_v + 1;
+			int next_var = component[ index_c + 1 ];
 			std::vector<std::vector<int>> solutions;
-			for( auto value : new_domains[next_var] )
+			for( auto value : domain_of( new_domains, next_var ) )
 			{
+				if( run.must_stop() )
+					break;
+
+				++run.nodes;
 				_model.variables[next_var].set_value( value );
 				
 				// last variable
-				if( next_var == _model.variables.size() - 1 )
+				if( index_c + 2 == static_cast<int>( component.size() ) )
 				{
 					std::vector<int> solution;
-					for( auto& var : _model.variables )
-						solution.emplace_back( var.get_value() );
+					for( int variable_id : component )
+						solution.emplace_back( _model.variables[ variable_id ].get_value() );
 					
 					solutions.emplace_back( solution );
 				}
 				else // not the last variable: recursive call
 				{					
-					auto partial_solutions = complete_search( next_var, new_domains );
+					auto partial_solutions = complete_search( component, index_c + 1, new_domains, run );
 					if( !partial_solutions.empty() )
 						std::copy_if( partial_solutions.begin(),
 						              partial_solutions.end(), 
@@ -345,6 +641,266 @@ namespace ghost
 			
 			return solutions;
 		}
+
+		// Search for all solutions of a connected component, returned as vectors of values of the component's variables.
+		// Components share neither variables nor constraints, so different components can be searched in parallel.
+		// Only the domains of the component's variables are copied during the search.
+		std::vector<std::vector<int>> search_component( const std::vector<int>& component, const std::vector< std::vector<int>>& model_domains, CompleteSearchRun& run )
+		{
+			std::vector< std::vector<int>> domains;
+			domains.reserve( component.size() );
+			for( int variable_id : component )
+				domains.push_back( model_domains[ variable_id ] );
+
+			std::vector<std::vector<int>> solutions;
+			int first_var = component[0];
+
+			for( int value : domain_of( domains, first_var ) )
+			{
+				if( run.must_stop() )
+					break;
+
+				++run.nodes;
+				_model.variables[ first_var ].set_value( value );
+
+				// isolated variable: all remaining values are solutions
+				if( component.size() == 1 )
+				{
+					solutions.emplace_back( 1, value );
+					continue;
+				}
+
+				auto new_domains = ac3_filtering( first_var, domains );
+				++run.propagations;
+				auto empty_domain = std::find_if( new_domains.cbegin(), new_domains.cend(), [&]( auto& domain ){ return domain.empty(); } );
+
+				if( empty_domain == new_domains.cend() )
+				{
+					auto partial_solutions = complete_search( component, 0, new_domains, run );
+					std::move( partial_solutions.begin(), partial_solutions.end(), std::back_inserter( solutions ) );
+				}
+				else
+					++run.fails;
+			}
+
+			return solutions;
+		}
+		
+		// Search each connected component of the model separately, storing their solutions in _component_solutions.
+		// Return true iff every component has some solutions, i.e., iff the model has some solutions.
+		bool search_all_components( std::chrono::microseconds timeout, Options& options )
+		{
+			_options = options;
+			CompleteSearchRun run( timeout, _options );
+			_statistics = SolverStatistics();
+			_statistics.search = "complete_search";
+			_component_solutions.clear();
+			_component_costs.clear();
+
+			_model = _model_builder.build_model();
+
+			std::vector< std::vector<int> > domains;
+			for( auto& var : _model.variables )
+				domains.emplace_back( var.get_full_domain() );
+
+			initialize_filtering( domains );
+
+			prefiltering( domains );
+			
+			if( std::any_of( domains.cbegin(), domains.cend(), [&]( auto& domain ){ return domain.empty(); } ) )
+				return false;
+
+			// Independent subproblems are solved separately, and their solutions are combined on demand.
+			compute_components();
+			int number_components = static_cast<int>( _components.size() );
+			_component_solutions.resize( number_components );
+			std::atomic<bool> unsatisfiable( false );
+			std::atomic<int> next_component( 0 );
+
+			// Smallest components first: they detect unsatisfiability the fastest, and are likely completed if the search is interrupted.
+			std::vector<int> search_order( number_components );
+			std::iota( search_order.begin(), search_order.end(), 0 );
+			std::stable_sort( search_order.begin(), search_order.end(), [&]( int c1, int c2 ){ return _components[ c1 ].size() < _components[ c2 ].size(); } );
+
+			// Components are picked one by one. Stop as soon as a component has no solutions, since the whole problem has none.
+			auto search_components = [&]()
+			{
+				for( int order = next_component++ ; order < number_components && !unsatisfiable && !run.interrupted ; order = next_component++ )
+				{
+					int component_id = search_order[ order ];
+					_component_solutions[ component_id ] = search_component( _components[ component_id ], domains, run );
+					if( _component_solutions[ component_id ].empty() && !run.interrupted )
+						unsatisfiable = true;
+				}
+			};
+
+			int number_threads = _options.parallel_runs ? std::min( _options.number_threads, number_components ) : 1;
+			if( number_threads <= 1 )
+				search_components();
+			else
+			{
+				std::vector<std::thread> component_threads;
+				for( int i = 0 ; i < number_threads ; ++i )
+					component_threads.emplace_back( search_components );
+				for( auto& component_thread : component_threads )
+					component_thread.join();
+			}
+
+			_statistics.is_optimization = _model.objective->is_optimization();
+			_statistics.parallel_runs = number_threads > 1;
+			_statistics.number_threads = number_threads;
+			_statistics.nodes = run.nodes;
+			_statistics.fails = run.fails;
+			_statistics.propagations = run.propagations;
+			_statistics.interrupted = run.interrupted;
+			_statistics.search_time = std::chrono::duration<double,std::micro>( std::chrono::steady_clock::now() - run.start ).count();
+
+			// If the search has been interrupted, some components may have no solutions found yet
+			if( unsatisfiable || std::any_of( _component_solutions.cbegin(), _component_solutions.cend(), [&]( auto& solutions ){ return solutions.empty(); } ) )
+			{
+				_component_solutions.clear();
+				return false;
+			}
+
+			_statistics.solution_found = true;
+			_statistics.number_solutions = 1.0;
+			for( auto& solutions : _component_solutions )
+				_statistics.number_solutions *= static_cast<double>( solutions.size() );
+
+			compute_component_costs();
+			return true;
+		}
+
+		// Fill _component_costs if the cost of a combination of components' solutions is a sum of terms over components,
+		// i.e., if the objective function is separable or only depends on the variables of one component.
+		// Each solution of a component is then evaluated once, rather than once per combination.
+		void compute_component_costs()
+		{
+			int number_components = static_cast<int>( _components.size() );
+			bool is_optimization = _model.objective->is_optimization();
+
+			std::vector<bool> in_objective( number_components, false );
+			if( is_optimization )
+			{
+				std::vector<int> component_of( _model.variables.size() );
+				for( int component_id = 0 ; component_id < number_components ; ++component_id )
+					for( int variable_id : _components[ component_id ] )
+						component_of[ variable_id ] = component_id;
+
+				for( int variable_id : _model.objective->_variables_index )
+					in_objective[ component_of[ variable_id ] ] = true;
+
+				if( !_model.objective->optional_is_separable() && std::count( in_objective.begin(), in_objective.end(), true ) > 1 )
+					return;
+			}
+
+			for( int component_id = 0 ; component_id < number_components ; ++component_id )
+				assign_component_solution( component_id, 0 );
+
+			_first_solutions_cost = is_optimization ? _model.objective->cost() : 0.0;
+
+			_component_costs.resize( number_components );
+			for( int component_id = 0 ; component_id < number_components ; ++component_id )
+			{
+				int number_solutions = static_cast<int>( _component_solutions[ component_id ].size() );
+				_component_costs[ component_id ].assign( number_solutions, 0.0 );
+				if( !in_objective[ component_id ] )
+					continue;
+
+				for( int solution_id = 1 ; solution_id < number_solutions ; ++solution_id )
+				{
+					assign_component_solution( component_id, solution_id );
+					_component_costs[ component_id ][ solution_id ] = _model.objective->cost() - _first_solutions_cost;
+				}
+
+				assign_component_solution( component_id, 0 );
+			}
+		}
+
+		// Assign to the variables of a component one of its solutions.
+		inline void assign_component_solution( int component_id, int solution_id )
+		{
+			auto& component = _components[ component_id ];
+			auto& solution = _component_solutions[ component_id ][ solution_id ];
+			for( int i = 0 ; i < static_cast<int>( component.size() ) ; ++i )
+				_model.variables[ component[ i ] ].set_value( solution[ i ] );
+		}
+
+		// Number of combinations of components' solutions, saturated to the maximal value of std::size_t.
+		std::size_t number_combinations() const
+		{
+			if( _component_solutions.empty() )
+				return 0;
+
+			std::size_t number = 1;
+			for( auto& solutions : _component_solutions )
+			{
+				if( solutions.size() > std::numeric_limits<std::size_t>::max() / number )
+					return std::numeric_limits<std::size_t>::max();
+				number *= solutions.size();
+			}
+
+			return number;
+		}
+
+		// Assign to variables the combination of components' solutions of the given index, last components varying
+		// first, and return its cost, negated for maximization problems like Objective::cost.
+		double assign_solution( std::size_t index )
+		{
+			double cost = _first_solutions_cost;
+			for( int component_id = static_cast<int>( _components.size() ) - 1 ; component_id >= 0 ; --component_id )
+			{
+				std::size_t number_solutions = _component_solutions[ component_id ].size();
+				int solution_id = static_cast<int>( index % number_solutions );
+				index /= number_solutions;
+
+				assign_component_solution( component_id, solution_id );
+				if( !_component_costs.empty() )
+					cost += _component_costs[ component_id ][ solution_id ];
+			}
+
+			if( _component_costs.empty() )
+				cost = _model.objective->cost();
+
+			return cost;
+		}
+
+		// Index of a combination of components' solutions with the lowest cost. With component costs, the best solution of
+		// each component is picked separately. Otherwise, all combinations are evaluated.
+		std::size_t best_solution_index()
+		{
+			std::size_t best_index = 0;
+			if( !_component_costs.empty() )
+			{
+				for( int component_id = 0 ; component_id < static_cast<int>( _components.size() ) ; ++component_id )
+				{
+					auto& costs = _component_costs[ component_id ];
+					best_index = best_index * costs.size() + std::distance( costs.begin(), std::min_element( costs.begin(), costs.end() ) );
+				}
+
+				return best_index;
+			}
+
+			double best_cost = std::numeric_limits<double>::max();
+			std::size_t number_solutions = number_combinations();
+			for( std::size_t index = 0 ; index < number_solutions ; ++index )
+			{
+				double cost = assign_solution( index );
+				if( best_cost > cost )
+				{
+					best_cost = cost;
+					best_index = index;
+				}
+			}
+
+			return best_index;
+		}
+
+		// Cost with the sign given by the user, i.e., not negated for maximization problems.
+		inline double user_cost( double cost ) const
+		{
+			return _model.objective->is_maximization() ? -cost : cost;
+		}
 		
 	public:
 		/*!
@@ -359,20 +915,7 @@ namespace ghost
 			  _best_sat_error( std::numeric_limits<double>::max() ),
 			  _best_opt_cost( std::numeric_limits<double>::max() ),
 			  _cost_before_postprocess( std::numeric_limits<double>::max() ),
-			  _restarts_total( 0 ),
-			  _resets_total( 0 ),
-			  _local_moves_total( 0 ),
-			  _search_iterations_total( 0 ),
-			  _local_minimum_total( 0 ),
-			  _plateau_moves_total( 0 ),
-			  _plateau_force_trying_another_variable_total( 0 ),
-			  _restarts( 0 ),
-			  _resets( 0 ),
-			  _local_moves( 0 ),
-			  _search_iterations( 0 ),
-			  _local_minimum( 0 ),
-			  _plateau_moves( 0 ),
-			  _plateau_force_trying_another_variable( 0 )
+			  _first_solutions_cost( 0.0 )
 		{	}
 
 		/*!
@@ -447,6 +990,9 @@ namespace ghost
 			_number_variables = _model_builder.get_number_variables();
 
 			_options = options;
+			_search_profiles.clear();
+			_statistics = SolverStatistics();
+			_statistics.search = "fast_search";
 
 			if( _options.tabu_time_local_min < 0 )
 				_options.tabu_time_local_min = std::max( std::min( 5, static_cast<int>( _number_variables ) - 1 ), static_cast<int>( std::ceil( _number_variables / 5 ) ) ) + 1;
@@ -485,6 +1031,24 @@ namespace ghost
 			// In case final_solution is not a vector of the correct size,
 			// ie, equals to the number of variables.
 			final_solution.resize( _number_variables );
+
+			_preprocessed_domains.clear();
+			if( _options.preprocessing && !preprocess_domains() )
+			{
+				// Trivially unsatisfiable model: no need to search
+				_model = _model_builder.build_model();
+				_best_sat_error = 0.0;
+				for( auto& constraint : _model.constraints )
+					_best_sat_error += constraint->error();
+
+				final_cost = _best_sat_error;
+				std::transform( _model.variables.begin(),
+				                _model.variables.end(),
+				                final_solution.begin(),
+				                [&](auto& var){ return var.get_value(); } );
+				return false;
+			}
+
 			bool solution_found = false;
 			bool is_sequential;
 			bool is_optimization;
@@ -500,23 +1064,31 @@ namespace ghost
 			if( is_sequential )
 			{
 #if defined GHOST_RANDOM_WALK
-				SearchUnit search_unit( _model_builder.build_model(),
+				SearchUnit search_unit( build_search_model(),
 				                        _options,
 				                        std::make_unique<algorithms::UniformVariableHeuristic>(),
 				                        std::make_unique<algorithms::AllFreeVariableCandidatesHeuristic>(),
 				                        std::make_unique<algorithms::RandomWalkValueHeuristic>(),
 				                        std::make_unique<algorithms::NullErrorProjection>() );
 #elif defined GHOST_HILL_CLIMBING
-				SearchUnit search_unit( _model_builder.build_model(),
+				SearchUnit search_unit( build_search_model(),
 				                        _options,
 				                        std::make_unique<algorithms::UniformVariableHeuristic>(),
 				                        std::make_unique<algorithms::AllFreeVariableCandidatesHeuristic>(),
 				                        std::make_unique<algorithms::AdaptiveSearchValueHeuristic>(),
 				                        std::make_unique<algorithms::NullErrorProjection>() );
 #else				
-				SearchUnit search_unit( _model_builder.build_model(),
+				SearchUnit search_unit( build_search_model(),
 				                        _options );
 #endif
+				if( _options.seed >= 0 )
+					search_unit.rng.seed( static_cast<unsigned int>( _options.seed ) );
+
+#if defined GHOST_RECORD
+				TrajectoryRecorder recorder( _options.trajectory_file, 1 );
+				search_unit.trajectory = &recorder.buffer( 0 );
+#endif
+
 				is_optimization = search_unit.data.is_optimization;
 				std::future<bool> unit_future = search_unit.solution_found.get_future();
 
@@ -528,13 +1100,9 @@ namespace ghost
 				solution_found = unit_future.get();
 				_best_sat_error = search_unit.data.best_sat_error;
 				_best_opt_cost = search_unit.data.best_opt_cost;
-				_restarts = search_unit.data.restarts;
-				_resets = search_unit.data.resets;
-				_local_moves = search_unit.data.local_moves;
-				_search_iterations = search_unit.data.search_iterations;
-				_local_minimum = search_unit.data.local_minimum;
-				_plateau_moves = search_unit.data.plateau_moves;
-				_plateau_force_trying_another_variable = search_unit.data.plateau_force_trying_another_variable;
+				_search_profiles.push_back( search_unit.data.profile );
+				_statistics.units.push_back( unit_statistics( search_unit ) );
+				_statistics.winning_thread = 0;
 
 				_variable_heuristic = search_unit.variable_heuristic->get_name();
 				_variable_candidates_heuristic = search_unit.variable_candidates_heuristic->get_name();
@@ -553,25 +1121,37 @@ namespace ghost
 				{
 					// Instantiate one model per thread
 #if defined GHOST_RANDOM_WALK
-					units.emplace_back( _model_builder.build_model(),
+					units.emplace_back( build_search_model(),
 					                    _options,
 					                    std::make_unique<algorithms::UniformVariableHeuristic>(),
 					                    std::make_unique<algorithms::AllFreeVariableCandidatesHeuristic>(),
 					                    std::make_unique<algorithms::RandomWalkValueHeuristic>(),
 					                    std::make_unique<algorithms::NullErrorProjection>() );
 #elif defined GHOST_HILL_CLIMBING
-					units.emplace_back( _model_builder.build_model(),
+					units.emplace_back( build_search_model(),
 					                    _options,
 					                    std::make_unique<algorithms::UniformVariableHeuristic>(),
 					                    std::make_unique<algorithms::AllFreeVariableCandidatesHeuristic>(),
 					                    std::make_unique<algorithms::AdaptiveSearchValueHeuristic>(),
 					                    std::make_unique<algorithms::NullErrorProjection>() );
 #else				
-					units.emplace_back( _model_builder.build_model(),
+					units.emplace_back( build_search_model(),
 					                    _options );
 #endif
 				}
 
+				// Each thread gets its own seed, otherwise they would all follow the same trajectory.
+				if( _options.seed >= 0 )
+					for( int i = 0 ; i < _options.number_threads; ++i )
+						units.at( i ).rng.seed( static_cast<unsigned int>( _options.seed ) + static_cast<unsigned int>( i ) );
+
+#if defined GHOST_RECORD
+				// Unit threads are joined before the end of this block, i.e., before the recorder flushes and closes the file.
+				TrajectoryRecorder recorder( _options.trajectory_file, _options.number_threads );
+				for( int i = 0 ; i < _options.number_threads; ++i )
+					units.at( i ).trajectory = &recorder.buffer( i );
+#endif
+
 				is_optimization = units[0].data.is_optimization;
 
 				std::vector<std::future<bool>> units_future;
@@ -652,13 +1232,8 @@ namespace ghost
 				{
 					units.at(i).stop_search();
 
-					_restarts_total += units.at(i).data.restarts;
-					_resets_total += units.at(i).data.resets;
-					_local_moves_total += units.at(i).data.local_moves;
-					_search_iterations_total += units.at(i).data.search_iterations;
-					_local_minimum_total += units.at(i).data.local_minimum;
-					_plateau_moves_total += units.at(i).data.plateau_moves;
-					_plateau_force_trying_another_variable_total += units.at(i).data.plateau_force_trying_another_variable;
+					_search_profiles.push_back( units.at(i).data.profile );
+					_statistics.units.push_back( unit_statistics( units.at(i) ) );
 				}
 
 				// ..then the most important: the best solution found so far.
@@ -670,18 +1245,11 @@ namespace ghost
 					_best_sat_error = units.at( winning_thread ).data.best_sat_error;
 					_best_opt_cost = units.at( winning_thread ).data.best_opt_cost;
 
-					_restarts = units.at( winning_thread ).data.restarts;
-					_resets = units.at( winning_thread ).data.resets;
-					_local_moves = units.at( winning_thread ).data.local_moves;
-					_search_iterations = units.at( winning_thread ).data.search_iterations;
-					_local_minimum = units.at( winning_thread ).data.local_minimum;
-					_plateau_moves = units.at( winning_thread ).data.plateau_moves;
-					_plateau_force_trying_another_variable = units.at( winning_thread ).data.plateau_force_trying_another_variable;
-
 					_variable_heuristic = units.at( winning_thread ).variable_heuristic->get_name();
 					_variable_candidates_heuristic = units.at( winning_thread ).variable_candidates_heuristic->get_name();
 					_value_heuristic = units.at( winning_thread ).value_heuristic->get_name();
 					_error_projection_algorithm = units.at( winning_thread ).error_projection_algorithm->get_name();
+					_statistics.winning_thread = winning_thread;
 
 					_model = std::move( units.at( winning_thread ).transfer_model() );
 				}
@@ -706,18 +1274,11 @@ namespace ghost
 							}
 					}
 
-					_restarts = units.at( best_non_solution ).data.restarts;
-					_resets = units.at( best_non_solution ).data.resets;
-					_local_moves = units.at( best_non_solution ).data.local_moves;
-					_search_iterations = units.at( best_non_solution ).data.search_iterations;
-					_local_minimum = units.at( best_non_solution ).data.local_minimum;
-					_plateau_moves = units.at( best_non_solution ).data.plateau_moves;
-					_plateau_force_trying_another_variable = units.at( best_non_solution ).data.plateau_force_trying_another_variable;
-
 					_variable_heuristic = units.at( best_non_solution ).variable_heuristic->get_name();
 					_variable_candidates_heuristic = units.at( best_non_solution ).variable_candidates_heuristic->get_name();
 					_value_heuristic = units.at( best_non_solution ).value_heuristic->get_name();
 					_error_projection_algorithm = units.at( best_non_solution ).error_projection_algorithm->get_name();
+					_statistics.winning_thread = best_non_solution;
 					
 					_model = std::move( units.at( best_non_solution ).transfer_model() );
 				}
@@ -761,6 +1322,42 @@ namespace ghost
 			elapsed_time = std::chrono::steady_clock::now() - start_wall_clock;
 			chrono_full_computation = elapsed_time.count();
 
+			_statistics.solution_found = solution_found;
+			_statistics.is_optimization = is_optimization;
+			_statistics.parallel_runs = !is_sequential;
+			_statistics.number_threads = is_sequential ? 1 : _options.number_threads;
+			_statistics.variable_heuristic = _variable_heuristic;
+			_statistics.variable_candidates_heuristic = _variable_candidates_heuristic;
+			_statistics.value_heuristic = _value_heuristic;
+			_statistics.error_projection_algorithm = _error_projection_algorithm;
+			_statistics.satisfaction_error = _best_sat_error;
+			if( is_optimization )
+			{
+				_statistics.optimization_cost = _best_opt_cost;
+				_statistics.cost_before_postprocess = solution_found ? _cost_before_postprocess : _best_opt_cost;
+			}
+			_statistics.search_time = chrono_search;
+			_statistics.postprocess_time = timer_postprocess.count();
+			_statistics.wall_clock_time = chrono_full_computation;
+			_statistics.winning_unit = _statistics.units.at( _statistics.winning_thread );
+			_statistics.total.satisfaction_error = _statistics.winning_unit.satisfaction_error;
+			_statistics.total.optimization_cost = _statistics.winning_unit.optimization_cost;
+			for( const auto& unit : _statistics.units )
+			{
+				_statistics.total.search_iterations += unit.search_iterations;
+				_statistics.total.local_moves += unit.local_moves;
+				_statistics.total.plateau_moves += unit.plateau_moves;
+				_statistics.total.plateau_force_trying_another_variable += unit.plateau_force_trying_another_variable;
+				_statistics.total.local_minimum += unit.local_minimum;
+				_statistics.total.resets += unit.resets;
+				_statistics.total.restarts += unit.restarts;
+			}
+			if( chrono_search > 0 )
+			{
+				_statistics.moves_per_second = _statistics.winning_unit.local_moves * 1000000.0 / chrono_search;
+				_statistics.total_moves_per_second = _statistics.total.local_moves * 1000000.0 / chrono_search;
+			}
+
 #if defined GHOST_DEBUG || defined GHOST_TRACE || defined GHOST_BENCH
 			std::cout << "@@@@@@@@@@@@" << "\n"
 			          << "Variable heuristic: " << _variable_heuristic << "\n"
@@ -805,20 +1402,24 @@ namespace ghost
 			          << "Search time: " << chrono_search << "us (= " << chrono_search / 1000 << "ms, " << chrono_search / 1000000 << "s)\n"
 			          << "Wall-clock time (full call): " << chrono_full_computation << "us (= " << chrono_full_computation/1000 << "ms, " << chrono_full_computation/1000000 << "s)\n"
 			          << "Satisfaction error: " << _best_sat_error << "\n"
-			          << "Number of search iterations: " << _search_iterations << "\n"
-			          << "Number of local moves: " << _local_moves << " (including on plateau: " << _plateau_moves << ")\n"
-			          << "Number of local minimum: " << _local_minimum << "\n"
-			          << "Number of variable exploration forcing on a plateau: " << _plateau_force_trying_another_variable << "\n"
-			          << "Number of resets: " << _resets << "\n"
-			          << "Number of restarts: " << _restarts << "\n";
+			          << "Number of search iterations: " << _statistics.winning_unit.search_iterations << "\n"
+			          << "Number of local moves: " << _statistics.winning_unit.local_moves << " (including on plateau: " << _statistics.winning_unit.plateau_moves << ")\n"
+			          << "Number of local minimum: " << _statistics.winning_unit.local_minimum << "\n"
+			          << "Number of variable exploration forcing on a plateau: " << _statistics.winning_unit.plateau_force_trying_another_variable << "\n"
+			          << "Number of resets: " << _statistics.winning_unit.resets << "\n"
+			          << "Number of restarts: " << _statistics.winning_unit.restarts << "\n";
 
 			if( _options.parallel_runs )
-				std::cout << "Total number of search iterations: " << _search_iterations_total << "\n"
-				          << "Total number of local moves: " << _local_moves_total << " (including on plateau: " << _plateau_moves_total << ")\n"
-				          << "Total number of local minimum: " << _local_minimum_total << "\n"
-				          << "Total number of variable exploration forcing on a plateau: " << _plateau_force_trying_another_variable_total << "\n"
-				          << "Total number of resets: " << _resets_total << "\n"
-				          << "Total number of restarts: " << _restarts_total << "\n";
+				std::cout << "Total number of search iterations: " << _statistics.total.search_iterations << "\n"
+				          << "Total number of local moves: " << _statistics.total.local_moves << " (including on plateau: " << _statistics.total.plateau_moves << ")\n"
+				          << "Total number of local minimum: " << _statistics.total.local_minimum << "\n"
+				          << "Total number of variable exploration forcing on a plateau: " << _statistics.total.plateau_force_trying_another_variable << "\n"
+				          << "Total number of resets: " << _statistics.total.resets << "\n"
+				          << "Total number of restarts: " << _statistics.total.restarts << "\n";
+
+#if defined GHOST_PROFILE
+			std::cout << "\nSearch profile (all threads):\n" << get_search_profile();
+#endif
 
 			if( is_optimization )
 				std::cout << "\nOptimization cost: " << _best_opt_cost << "\n";
@@ -903,7 +1504,7 @@ namespace ghost
 
 	
 		/*!
-		 * Method to look for all solutions of a given CSP/COP/EF-CSP/EF-COP model.
+		 * Method to look for all solutions of a given CSP/COP/EF-CSP/EF-COP model, within a time budget.
 		 *
 		 * This method returns true if at least one solution of the problem exists, and flase otherwise.
 		 * It will write the error/cost of all solutions in the final_costs parameter, and all solutions
@@ -917,73 +1518,158 @@ namespace ghost
 		 * be as low as possible: GHOST is always trying to minimize problems. If you have a
 		 * maximization problem, GHOST will automatically convert it into a minimization problem.
 		 *
+		 * If the model is composed of independent subproblems, i.e., sets of variables not linked
+		 * by any constraints, each subproblem is solved separately and all solutions of the model
+		 * are obtained by combining subproblems' solutions. With parallel runs, subproblems are
+		 * solved simultaneously. Since the number of combinations grows exponentially with the
+		 * number of subproblems, users should rather call the Solver::complete_search method
+		 * outputing a best solution only, and get other solutions one by one with
+		 * Solver::get_solution.
+		 *
+		 * The search stops when the timeout is reached, when the number of explored nodes reaches
+		 * Options::node_limit, or when the flag Options::cancel_search is set to true from another
+		 * thread. In that case, final_costs and final_solutions only contain solutions found so far,
+		 * and the method returns true if and only if at least one solution has been found. Search
+		 * statistics are available with Solver::get_statistics.
+		 *
 		 * Finally, options to change the solver behaviors (parallel runs, user-defined solution
-		 * printing) can be given as a last parameter.
+		 * printing, search budgets) can be given as a last parameter.
 		 *
-		 * \param final_costs a reference to a vector of double to get the errors of all solutions for 
+		 * \param final_costs a reference to a vector of double to get the errors of all solutions for
 		 * satisfaction problems, or their objective function value for optimization problems 
 		 * For satisfaction problems, a cost of zero means a solution has been found.
 		 * \param final_solutions a reference to a vector of vector of integers, containing all solutions
 		 * of the problem instance.
+		 * \param timeout a std::chrono::microseconds for the time budget allowed to the solver.
+		 * Higher std::chrono durations (such as milliseconds, seconds, etc) would be automatically
+		 * converted into microseconds.
 		 * \param options a reference to an Options object containing options such as parallel runs,
-		 * a solution printer, etc.
-		 * \return True if and only a solution of the problem exists.
+		 * a solution printer, a node limit, etc.
+		 * \return True if and only a solution of the problem exists (or has been found, if the search
+		 * has been interrupted).
 		 */
 		bool complete_search( std::vector<double>& final_costs,
 		                      std::vector<std::vector<int>>& final_solutions,
+		                      std::chrono::microseconds timeout,
 		                      Options& options )
 		{
-			// init data
-			bool solutions_exist = false;
-			_options = options;
-
-			_model = _model_builder.build_model();
+			auto start = std::chrono::steady_clock::now();
+			if( !search_all_components( timeout, options ) )
+				return false;
+
+			// Solutions of the model are all combinations of components' solutions.
+			std::size_t number_solutions = number_combinations();
+			std::vector<int> solution( _model.variables.size() );
+			for( std::size_t index = 0 ; index < number_solutions ; ++index )
+			{
+				final_costs.push_back( user_cost( assign_solution( index ) ) );
 
-			std::vector< std::vector<int> > domains;
-			for( auto& var : _model.variables )
-				domains.emplace_back( var.get_full_domain() );
+				std::transform( _model.variables.begin(),
+				                _model.variables.end(),
+				                solution.begin(),
+				                [&](auto& var){ return var.get_value(); } );
+				final_solutions.push_back( solution );
+			}
 
-			_matrix_var_ctr.resize( _model.variables.size() );
-			for( int variable_id = 0; variable_id < static_cast<int>( _model.variables.size() ); ++variable_id )
+			if( _statistics.is_optimization )
 			{
-				_matrix_var_ctr[ variable_id ] = std::vector<int>();
-				for( int constraint_id = 0; constraint_id < static_cast<int>( _model.constraints.size() ); ++constraint_id )
-					if( _model.constraints[ constraint_id ]->has_variable( variable_id ) )
-						_matrix_var_ctr[ variable_id ].push_back( constraint_id );
+				if( _model.objective->is_maximization() )
+					_statistics.optimization_cost = *std::max_element( final_costs.cbegin(), final_costs.cend() );
+				else
+					_statistics.optimization_cost = *std::min_element( final_costs.cbegin(), final_costs.cend() );
+				_statistics.cost_before_postprocess = _statistics.optimization_cost;
 			}
+			_statistics.wall_clock_time = std::chrono::duration<double,std::micro>( std::chrono::steady_clock::now() - start ).count();
 
-			prefiltering( domains );
-			
-			for( int value : domains[0] )
-			{
-				_model.variables[0].set_value( value );
-				auto new_domains = ac3_filtering( 0, domains );
-				auto empty_domain = std::find_if( new_domains.cbegin(), new_domains.cend(), [&]( auto& domain ){ return domain.empty(); } );
+			return true;
+		}
 
-				if( empty_domain == new_domains.cend() )
-				{
-					std::vector<std::vector<int>> partial_solutions = complete_search( 0, new_domains );
-					
-					for( auto& solution : partial_solutions )
-						if( !solution.empty() )
-						{
-							solutions_exist = true;
-							for( int i = 1 ; i < static_cast<int>( solution.size() ) ; ++i )
-								_model.variables[i].set_value( solution[i] );
+		/*!
+		 * Method to look for a best solution of a given CSP/COP/EF-CSP/EF-COP model with a complete
+		 * search, within a time budget.
+		 *
+		 * This method explores the same search space than the Solver::complete_search methods outputing
+		 * all solutions, but only outputs a best one: a solution with the lowest cost, or the highest one
+		 * for maximization problems. For satisfaction problems, this is the first solution found.
+		 *
+		 * If the model is composed of independent subproblems, solutions of each subproblem are stored
+		 * separately and are not combined: all solutions of the model can still be obtained one by one
+		 * with Solver::get_solution, and their number is given by SolverStatistics::number_solutions.
+		 * If the objective function is separable (see Objective::optional_is_separable), or only depends
+		 * on variables of one subproblem, a best solution is obtained by optimizing each subproblem
+		 * separately. Otherwise, combinations of solutions are evaluated one by one.
+		 *
+		 * \param final_cost a reference to a double to get the error of the best solution for
+		 * satisfaction problems, or its objective function value for optimization problems.
+		 * \param final_solution a reference to a vector of integers, to get values of the best solution.
+		 * \param timeout a std::chrono::microseconds for the time budget allowed to the solver.
+		 * \param options a reference to an Options object containing options such as parallel runs,
+		 * a solution printer, a node limit, etc.
+		 * \return True if and only a solution of the problem exists (or has been found, if the search
+		 * has been interrupted).
+		 */
+		bool complete_search( double& final_cost,
+		                      std::vector<int>& final_solution,
+		                      std::chrono::microseconds timeout,
+		                      Options& options )
+		{
+			auto start = std::chrono::steady_clock::now();
+			if( !search_all_components( timeout, options ) )
+				return false;
 
-							double cost = _model.objective->cost();
-							if( _model.objective->is_maximization() )
-								cost = -cost;
+			final_cost = user_cost( assign_solution( best_solution_index() ) );
+			final_solution.resize( _model.variables.size() );
+			std::transform( _model.variables.begin(),
+			                _model.variables.end(),
+			                final_solution.begin(),
+			                [&](auto& var){ return var.get_value(); } );
 
-							final_costs.push_back( cost );
-							final_solutions.emplace_back( solution );
-						}
-				}
+			if( _statistics.is_optimization )
+			{
+				_statistics.optimization_cost = final_cost;
+				_statistics.cost_before_postprocess = final_cost;
 			}
+			_statistics.wall_clock_time = std::chrono::duration<double,std::micro>( std::chrono::steady_clock::now() - start ).count();
 
-			// need to reassigned the variables value to solutions one by one
-			//std::cout << _options.print->print_candidate( _model.variables ).str();
-			return solutions_exist;			
+			return true;
+		}
+
+		/*!
+		 * Call Solver::complete_search with a time budget and default options.
+		 *
+		 * \param final_costs a reference to a vector of double to get the errors of all solutions for 
+		 * satisfaction problems, or their objective function value for optimization problems 
+		 * For satisfaction problems, a cost of zero means a solution has been found.
+		 * \param final_solutions a reference to a vector of vector of integers, containing all solutions
+		 * of the problem instance.
+		 * \param timeout a std::chrono::microseconds for the time budget allowed to the solver.
+		 * \return True if and only a solution of the problem exists (or has been found, if the search
+		 * has been interrupted).
+		 */
+		bool complete_search( std::vector<double>& final_costs, std::vector<std::vector<int>>& final_solutions, std::chrono::microseconds timeout )
+		{
+			Options options;
+			return complete_search( final_costs, final_solutions, timeout, options );
+		}
+
+		/*!
+		 * Call Solver::complete_search without time budget. The search can still be interrupted with
+		 * Options::node_limit and Options::cancel_search.
+		 *
+		 * \param final_costs a reference to a vector of double to get the errors of all solutions for
+		 * satisfaction problems, or their objective function value for optimization problems 
+		 * For satisfaction problems, a cost of zero means a solution has been found.
+		 * \param final_solutions a reference to a vector of vector of integers, containing all solutions
+		 * of the problem instance.
+		 * \param options a reference to an Options object containing options such as parallel runs,
+		 * a solution printer, a node limit, etc.
+		 * \return True if and only a solution of the problem exists.
+		 */
+		bool complete_search( std::vector<double>& final_costs,
+		                      std::vector<std::vector<int>>& final_solutions,
+		                      Options& options )
+		{
+			return complete_search( final_costs, final_solutions, std::chrono::microseconds::max(), options );
 		}
 
 		/*!
@@ -1004,6 +1690,64 @@ namespace ghost
 			return complete_search( final_costs, final_solutions, options );
 		}
 
+		/*!
+		 * Method to get a solution found by the last call of Solver::complete_search, by its index.
+		 *
+		 * If the model is composed of independent subproblems, solutions are built on demand by
+		 * combining solutions of each subproblem, such that all solutions of the model never need to be
+		 * stored. Solutions are indexed in the same order than the vector of all solutions output by
+		 * Solver::complete_search, and their number is given by SolverStatistics::number_solutions.
+		 *
+		 * \param index the index of the solution, from 0.
+		 * \param final_cost a reference to a double to get the error of the solution for satisfaction
+		 * problems, or its objective function value for optimization problems.
+		 * \param final_solution a reference to a vector of integers, to get values of the solution.
+		 * \return True if and only if index refers to a solution.
+		 */
+		bool get_solution( std::size_t index, double& final_cost, std::vector<int>& final_solution )
+		{
+			if( index >= number_combinations() )
+				return false;
+
+			final_cost = user_cost( assign_solution( index ) );
+			final_solution.resize( _model.variables.size() );
+			std::transform( _model.variables.begin(),
+			                _model.variables.end(),
+			                final_solution.begin(),
+			                [&](auto& var){ return var.get_value(); } );
+
+			return true;
+		}
+
+		/*!
+		 * Method to get statistics about the last call of Solver::fast_search or Solver::complete_search,
+		 * whichever was called last: counters of each search unit, winning unit, heuristics, time split
+		 * and moves per second. Statistics can be exported to JSON or CSV, see SolverStatistics.
+		 * \return A SolverStatistics object.
+		 */
+		inline SolverStatistics get_statistics() const { return _statistics; }
+
+		/*!
+		 * Method to get the time spent in each phase of the last call of Solver::fast_search, summed over
+		 * all search units (i.e., all threads for parallel runs). Profiles are only filled if the macro
+		 * GHOST_PROFILE is given to the compiler.
+		 * \return A SearchProfile object.
+		 */
+		inline SearchProfile get_search_profile() const
+		{
+			SearchProfile profile;
+			for( const auto& unit_profile : _search_profiles )
+				profile += unit_profile;
+			return profile;
+		}
+
+		/*!
+		 * Method to get the profile of each search unit of the last call of Solver::fast_search, i.e.,
+		 * one profile per thread for parallel runs. See Solver::get_search_profile.
+		 * \return A vector of SearchProfile objects.
+		 */
+		inline std::vector<SearchProfile> get_search_profiles() const { return _search_profiles; }
+
 		/*!
 		 * Method to get the variables in the model. This method can be handy in some situations,
 		 * if users do not know what the variables composing their problem instance are, and need 
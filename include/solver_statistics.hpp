@@ -0,0 +1,169 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ghost
+{
+	/*!
+	 * SearchUnitStatistics is a structure containing the counters of one search unit, i.e., of one
+	 * thread for parallel runs, during the last call of Solver::fast_search.
+	 *
+	 * \sa SolverStatistics
+	 */
+	struct SearchUnitStatistics
+	{
+		int search_iterations; //!< Number of iterations of the search loop.
+		int local_moves; //!< Number of local moves, including moves on plateaus.
+		int plateau_moves; //!< Number of local moves on plateaus.
+		int plateau_force_trying_another_variable; //!< Number of times another variable has been forced to be explored on a plateau.
+		int local_minimum; //!< Number of local minima met during the search.
+		int resets; //!< Number of resets.
+		int restarts; //!< Number of restarts.
+		double satisfaction_error; //!< Best satisfaction error reached by the unit.
+		double optimization_cost; //!< Best optimization cost reached by the unit, before post-processing.
+
+		//! Unique constructor
+		SearchUnitStatistics()
+			: search_iterations( 0 ),
+			  local_moves( 0 ),
+			  plateau_moves( 0 ),
+			  plateau_force_trying_another_variable( 0 ),
+			  local_minimum( 0 ),
+			  resets( 0 ),
+			  restarts( 0 ),
+			  satisfaction_error( 0.0 ),
+			  optimization_cost( 0.0 )
+		{ }
+	};
+
+	/*!
+	 * SolverStatistics is a structure containing everything measured during the last call of
+	 * Solver::fast_search or Solver::complete_search, available through Solver::get_statistics
+	 * without compiling GHOST with GHOST_DEBUG, GHOST_TRACE or GHOST_BENCH.
+	 *
+	 * Fields that do not make sense for the last kind of search keep their default value: the
+	 * search unit counters and heuristic names are only filled by Solver::fast_search, node and
+	 * propagation counters only by Solver::complete_search.
+	 *
+	 * Statistics can be exported with SolverStatistics::to_json, or with SolverStatistics::to_csv
+	 * and SolverStatistics::units_to_csv, one line per call or per search unit respectively.
+	 *
+	 * \sa Solver, SearchUnitStatistics
+	 */
+	struct SolverStatistics
+	{
+		std::string search; //!< Either "fast_search" or "complete_search", or empty if no searches have been run.
+		bool solution_found; //!< True iff a solution has been found.
+		bool is_optimization; //!< True iff the model has an objective function.
+		bool parallel_runs; //!< True iff the search ran over several threads.
+		int number_threads; //!< Number of threads used by the search.
+		int winning_thread; //!< Index of the search unit whose solution or candidate has been returned, -1 if irrelevant.
+
+		std::string variable_heuristic; //!< Name of the variable heuristic of the winning unit.
+		std::string variable_candidates_heuristic; //!< Name of the variable candidates heuristic of the winning unit.
+		std::string value_heuristic; //!< Name of the value heuristic of the winning unit.
+		std::string error_projection_algorithm; //!< Name of the error projection algorithm of the winning unit.
+
+		double satisfaction_error; //!< Satisfaction error of the returned candidate.
+		double optimization_cost; //!< Optimization cost of the returned candidate, after post-processing.
+		double cost_before_postprocess; //!< Optimization cost of the returned candidate, before post-processing.
+
+		double search_time; //!< Wall-clock time of the search itself, in microseconds.
+		double postprocess_time; //!< Wall-clock time of Objective::postprocess, in microseconds.
+		double wall_clock_time; //!< Wall-clock time of the full call, in microseconds.
+		double moves_per_second; //!< Local moves per second of the winning unit.
+		double total_moves_per_second; //!< Local moves per second, summed over all search units.
+
+		SearchUnitStatistics winning_unit; //!< Counters of the winning unit.
+		SearchUnitStatistics total; //!< Counters summed over all search units. Satisfaction errors and costs are the best ones.
+		std::vector<SearchUnitStatistics> units; //!< Counters of each search unit.
+
+		int nodes; //!< Number of nodes explored by Solver::complete_search.
+		int fails; //!< Number of nodes where domain filtering emptied a domain, in Solver::complete_search.
+		int propagations; //!< Number of calls to the domain filtering algorithm in Solver::complete_search.
+		double number_solutions; //!< Number of solutions found by Solver::complete_search, i.e., the product of the numbers of solutions of independent subproblems.
+		bool interrupted; //!< True iff Solver::complete_search has been stopped before exploring the whole search space.
+
+		//! Unique constructor
+		SolverStatistics()
+			: solution_found( false ),
+			  is_optimization( false ),
+			  parallel_runs( false ),
+			  number_threads( 1 ),
+			  winning_thread( -1 ),
+			  satisfaction_error( 0.0 ),
+			  optimization_cost( 0.0 ),
+			  cost_before_postprocess( 0.0 ),
+			  search_time( 0.0 ),
+			  postprocess_time( 0.0 ),
+			  wall_clock_time( 0.0 ),
+			  moves_per_second( 0.0 ),
+			  total_moves_per_second( 0.0 ),
+			  nodes( 0 ),
+			  fails( 0 ),
+			  propagations( 0 ),
+			  number_solutions( 0.0 ),
+			  interrupted( false )
+		{ }
+
+		/*!
+		 * Method to serialize statistics into a JSON object, including one object per search unit.
+		 * \return A std::string containing the JSON object.
+		 */
+		std::string to_json() const;
+
+		/*!
+		 * Method to get the header line matching SolverStatistics::to_csv.
+		 * \return A std::string containing comma-separated column names, without a trailing newline.
+		 */
+		static std::string csv_header();
+
+		/*!
+		 * Method to serialize statistics into one CSV line, without per-unit counters.
+		 * \return A std::string containing comma-separated values, without a trailing newline.
+		 */
+		std::string to_csv() const;
+
+		/*!
+		 * Method to get the header line matching SolverStatistics::units_to_csv.
+		 * \return A std::string containing comma-separated column names, without a trailing newline.
+		 */
+		static std::string units_csv_header();
+
+		/*!
+		 * Method to serialize the counters of each search unit into CSV lines, one per unit.
+		 * \return A std::string containing one newline-terminated line per search unit.
+		 */
+		std::string units_to_csv() const;
+	};
+}
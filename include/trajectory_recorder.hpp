@@ -0,0 +1,231 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ghost
+{
+	/*!
+	 * TrajectoryEvent is the fixed-size binary record written by TrajectoryRecorder for each
+	 * noticeable step of a search unit: variable and value selections, moves, local minima,
+	 * resets, restarts and new best candidates.
+	 *
+	 * \sa TrajectoryRecorder
+	 */
+	struct TrajectoryEvent
+	{
+		enum Type : std::uint8_t
+		{
+			VariableSelected, //!< variable has been selected; value is its current value.
+			ValueSelected, //!< value has been selected for variable; delta is the error delta of this move.
+			LocalMove, //!< variable took value, decreasing the error or the optimization cost.
+			PlateauMove, //!< variable took value on a plateau.
+			PlateauEscape, //!< variable has been marked as tabu on a plateau instead of moving.
+			LocalMinimum, //!< variable has been marked as tabu since no move improves the candidate.
+			Reset, //!< Some variables have been reassigned; value is the number of resets so far.
+			Restart, //!< All variables have been reassigned; value is the number of restarts so far.
+			BestSatisfactionError, //!< New best satisfaction error; error is its value.
+			BestOptimizationCost, //!< New best optimization cost; error is its value, not negated for maximization problems.
+			NumberTypes
+		};
+
+		std::int32_t iteration; //!< Search iteration of the event.
+		std::uint16_t unit; //!< Search unit, i.e., thread number for parallel runs.
+		std::uint8_t type; //!< Type of the event, see TrajectoryEvent::Type.
+		std::uint8_t padding; //!< Unused, keeps the record aligned.
+		std::int32_t variable; //!< Variable index, or -1 if irrelevant.
+		std::int32_t value; //!< Value, or variable index to swap with for permutation problems.
+		double delta; //!< Error delta of the selected value.
+		double error; //!< Satisfaction error of the candidate after the event, or the best cost for BestOptimizationCost.
+
+		//! Method to get the name of an event type, used by the decoders.
+		static std::string type_name( int type );
+
+		/*!
+		 * Method to decode the event into a line of text, close to GHOST_TRACE outputs.
+		 * \return A std::string without a trailing newline.
+		 */
+		std::string to_text() const;
+
+		/*!
+		 * Method to get the header line matching TrajectoryEvent::to_csv.
+		 * \return A std::string containing comma-separated column names, without a trailing newline.
+		 */
+		static std::string csv_header();
+
+		/*!
+		 * Method to decode the event into a CSV line.
+		 * \return A std::string containing comma-separated values, without a trailing newline.
+		 */
+		std::string to_csv() const;
+	};
+
+	/*!
+	 * TrajectoryBuffer is a single-producer, single-consumer lock-free ring buffer of TrajectoryEvent.
+	 * The producer is a search unit, the consumer is the writer thread of a TrajectoryRecorder.
+	 *
+	 * If the buffer is full, the producer waits for the writer thread to flush it, so that
+	 * trajectories are never truncated.
+	 *
+	 * \sa TrajectoryRecorder
+	 */
+	class TrajectoryBuffer
+	{
+		std::vector<TrajectoryEvent> _events;
+		std::size_t _mask;
+		std::uint16_t _unit;
+
+		// Written by the producer only; on their own cache lines to avoid false sharing with the consumer.
+		alignas( 64 ) std::atomic<std::size_t> _head;
+		std::size_t _cached_tail;
+
+		// Written by the consumer only.
+		alignas( 64 ) std::atomic<std::size_t> _tail;
+
+	public:
+		/*!
+		 * Unique constructor.
+		 * \param unit the search unit index written in each event.
+		 * \param capacity the number of events the buffer can hold. Must be a power of 2.
+		 */
+		TrajectoryBuffer( int unit, std::size_t capacity );
+
+		//! Append an event to the buffer. To be called by the producer thread only.
+		inline void record( TrajectoryEvent::Type type, int iteration, int variable, int value, double delta, double error )
+		{
+			std::size_t head = _head.load( std::memory_order_relaxed );
+			if( head - _cached_tail == _events.size() )
+				while( head - ( _cached_tail = _tail.load( std::memory_order_acquire ) ) == _events.size() )
+					std::this_thread::yield();
+
+			auto& event = _events[ head & _mask ];
+			event.iteration = iteration;
+			event.unit = _unit;
+			event.type = type;
+			event.padding = 0;
+			event.variable = variable;
+			event.value = value;
+			event.delta = delta;
+			event.error = error;
+
+			_head.store( head + 1, std::memory_order_release );
+		}
+
+		/*!
+		 * Write all events recorded so far into a stream and free their space. To be called
+		 * by the consumer thread only.
+		 * \return The number of written events.
+		 */
+		std::size_t flush( std::ofstream& stream );
+	};
+
+	/*!
+	 * TrajectoryRecorder writes the trajectory of each search unit of Solver::fast_search into
+	 * a binary file, when the macro GHOST_RECORD is given to the compiler. The file name is given
+	 * by Options::trajectory_file.
+	 *
+	 * Unlike GHOST_TRACE outputs, search units never format nor write anything themselves: they
+	 * append fixed-size events to their own TrajectoryBuffer, and a dedicated writer thread
+	 * flushes all buffers to the file in the background.
+	 *
+	 * A file starts with the 8 bytes "GHOSTTRJ", followed by the format version and the event size
+	 * as 32-bit integers, followed by events. Events of a search unit are in chronological order, but
+	 * events of different units are interleaved by chunks. Files are written with the endianness of
+	 * the machine. Use TrajectoryRecorder::read to load them.
+	 *
+	 * \sa TrajectoryEvent, Options
+	 */
+	class TrajectoryRecorder
+	{
+		std::ofstream _file;
+		std::vector<std::unique_ptr<TrajectoryBuffer>> _buffers;
+
+		// Only used to wake up the writer thread when the recorder is destroyed; search units never lock anything.
+		std::mutex _stop_mutex;
+		std::condition_variable _stop_signal;
+		bool _stop;
+
+		std::thread _writer;
+
+		void write_loop();
+
+	public:
+		static constexpr std::uint32_t version = 1; //!< Version of the file format.
+		static constexpr std::size_t buffer_capacity = 1 << 16; //!< Number of events per search unit buffer.
+		static constexpr std::chrono::milliseconds flush_period{ 10 }; //!< Time between two flushes of the writer thread.
+
+		struct trajectoryFileException : std::exception
+		{
+			std::string message;
+
+			trajectoryFileException( const std::string& filename, const std::string& reason )
+			{
+				message = "Trajectory file " + filename + ": " + reason + "\n";
+			}
+			const char* what() const noexcept { return message.c_str(); }
+		};
+
+		/*!
+		 * Unique constructor, opening the file and starting the writer thread.
+		 * \param filename the name of the binary file to write.
+		 * \param number_units the number of search units to record, each getting its own buffer.
+		 * \exception trajectoryFileException if the file cannot be opened.
+		 */
+		TrajectoryRecorder( const std::string& filename, int number_units );
+
+		//! The destructor flushes remaining events and closes the file. Search units must be done by then.
+		~TrajectoryRecorder();
+
+		TrajectoryRecorder( const TrajectoryRecorder& ) = delete;
+		TrajectoryRecorder& operator=( const TrajectoryRecorder& ) = delete;
+
+		//! Method to get the buffer of a search unit.
+		inline TrajectoryBuffer& buffer( int unit ) { return *_buffers[ unit ]; }
+
+		/*!
+		 * Method to load all events of a trajectory file.
+		 * \param filename the name of the binary file to read.
+		 * \return A vector of TrajectoryEvent, in file order.
+		 * \exception trajectoryFileException if the file cannot be opened or is not a trajectory file.
+		 */
+		static std::vector<TrajectoryEvent> read( const std::string& filename );
+	};
+}
@@ -57,6 +57,7 @@ namespace ghost
 	{
 		friend class SearchUnit;
 		friend class ModelBuilder;
+		template<typename ModelBuilderType> friend class Solver;
 
 		std::vector<int> _domain; // The domain, i.e., the vector of values the variable can take.
 		int _id; // Unique ID integer
@@ -81,6 +82,10 @@ namespace ghost
 		// Assign to the variable a random values from its domain.
 		inline void pick_random_value( randutils::mt19937_rng& rng ) {	_current_value = rng.pick( _domain ); }
 
+		// Replace the domain by a non-empty subset of it, computed by domain filtering.
+		// If the current value does not belong to the new domain, the variable takes the first value of the new domain.
+		void narrow_domain( const std::vector<int>& domain );
+
 	public:
 		//! Default constructor
 		Variable() = default;
@@ -45,7 +45,10 @@ void AdaptiveSearchErrorProjection::compute_variable_errors( const std::vector<V
 
 	for( int variable_id = 0; variable_id < static_cast<int>( variables.size() ); ++variable_id )
 		for( int constraint_id : data.matrix_var_ctr.at( variable_id ) )
-			data.error_variables[ variable_id ] += constraints[ constraint_id ]->_current_error;
+			if( !constraints[ constraint_id ]->is_optional_variable_error_defined() )
+				data.error_variables[ variable_id ] += constraints[ constraint_id ]->_current_error;
+
+	compute_projected_variable_errors( constraints, data );
 }
 
 void AdaptiveSearchErrorProjection::update_variable_errors( const std::vector<Variable>& variables,
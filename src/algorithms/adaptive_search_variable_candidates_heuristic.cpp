@@ -40,9 +40,18 @@ std::vector<double> AdaptiveSearchVariableCandidatesHeuristic::compute_variable_
 	std::vector<double> worst_variables_list;
 	double worst_variable_cost = -1;
 
+	// Once constraints are satisfied, focus on variables the objective cost depends on, if any is selectable.
+	for( int variable_id : data.critical_variables )
+		if( data.tabu_list[ variable_id ] <= data.local_moves && !data.fixed_variables[ variable_id ] )
+			worst_variables_list.push_back( variable_id );
+
+	if( !worst_variables_list.empty() )
+		return worst_variables_list;
+
 	for( int variable_id = 0; variable_id < data.number_variables; ++variable_id )
 		if( worst_variable_cost <= data.error_variables[ variable_id ]
 		    && data.tabu_list[ variable_id ] <= data.local_moves
+		    && !data.fixed_variables[ variable_id ]
 		    && ( !data.matrix_var_ctr.at( variable_id ).empty() || ( data.is_optimization && data.current_sat_error == 0 ) ) )
 		{
 			if( worst_variable_cost < data.error_variables[ variable_id ] )
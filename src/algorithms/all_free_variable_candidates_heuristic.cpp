@@ -39,7 +39,7 @@ std::vector<double> AllFreeVariableCandidatesHeuristic::compute_variable_candida
 {
 	std::vector<double> free_variables_list;
 	for( int variable_id = 0 ; variable_id < data.number_variables ; ++variable_id )
-		if( data.tabu_list[ variable_id ] <= data.local_moves )
+		if( data.tabu_list[ variable_id ] <= data.local_moves && !data.fixed_variables[ variable_id ] )
 			free_variables_list.push_back( variable_id );
 	
 	return free_variables_list;
@@ -41,7 +41,7 @@ std::vector<double> AntidoteSearchVariableCandidatesHeuristic::compute_variable_
 	auto error_variables = data.error_variables;
 		
 	for( int variable_id = 0; variable_id < data.number_variables; ++variable_id )
-		if( data.tabu_list[ variable_id ] > data.local_moves )
+		if( data.tabu_list[ variable_id ] > data.local_moves || data.fixed_variables[ variable_id ] )
 			error_variables[ variable_id ] = 0.0;
 
 	return error_variables;
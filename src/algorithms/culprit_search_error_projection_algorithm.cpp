@@ -117,6 +117,9 @@ void CulpritSearchErrorProjection::compute_variable_errors( const std::vector<Va
 	
 	for( auto constraint : constraints )
 	{
+		if( constraint->is_optional_variable_error_defined() )
+			continue;
+
 		compute_variable_errors_on_constraint( variables, data.matrix_var_ctr, constraint );
 		
 		// add normalize deltas of the current constraint to the error variables vector.
@@ -126,6 +129,8 @@ void CulpritSearchErrorProjection::compute_variable_errors( const std::vector<Va
 		                data.error_variables.begin(),
 		                std::plus<>{} );
 	}
+
+	compute_projected_variable_errors( constraints, data );
 }
 
 void CulpritSearchErrorProjection::update_variable_errors( const std::vector<Variable>& variables,
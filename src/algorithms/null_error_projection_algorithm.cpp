@@ -47,3 +47,9 @@ void NullErrorProjection::update_variable_errors( const std::vector<Variable>& v
                                                   SearchUnitData& data,                                                            
                                                   double delta )
 {}
+
+void NullErrorProjection::update_projected_variable_errors( std::shared_ptr<Constraint> constraint,
+                                                            SearchUnitData& data,
+                                                            int variable_id,
+                                                            int new_value )
+{}
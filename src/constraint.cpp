@@ -39,14 +39,18 @@ Constraint::Constraint( const std::vector<int>& variables_index )
 	: _variables_index( variables_index ),
 	  _current_error( std::numeric_limits<double>::max() ),
 	  _id( 0 ),
-	  _is_optional_delta_error_defined( true )
+	  _is_optional_delta_error_defined( true ),
+	  _is_optional_filter_domains_defined( true ),
+	  _is_optional_variable_error_defined( true )
 { }
 
 Constraint::Constraint( const std::vector<Variable>& variables )
 	: _variables_index( std::vector<int>( variables.size() ) ),
 	  _current_error( std::numeric_limits<double>::max() ),
 	  _id( 0 ),
-	  _is_optional_delta_error_defined( true )
+	  _is_optional_delta_error_defined( true ),
+	  _is_optional_filter_domains_defined( true ),
+	  _is_optional_variable_error_defined( true )
 {
 	std::transform( variables.begin(),
 	                variables.end(),
@@ -113,6 +117,21 @@ double Constraint::simulate_delta( const std::vector<int>& variables_index, cons
 	}
 }
 
+bool Constraint::filter_domains( std::vector<std::vector<int>>& domains ) const
+{
+	optional_filter_domains( _variables, domains );
+	return std::none_of( domains.cbegin(), domains.cend(), [&]( auto& domain ){ return domain.empty(); } );
+}
+
+void Constraint::variable_error_changes( int variable_id, int new_value, std::vector<std::pair<int, double>>& error_changes ) const
+{
+	error_changes.clear();
+	optional_variable_error_changes( _variables, _variables_position.at( variable_id ), new_value, error_changes );
+
+	for( auto& change : error_changes )
+		change.first = _variables_index[ change.first ];
+}
+
 bool Constraint::has_variable( int var_id ) const
 {
 	return _variables_position.count( var_id ) > 0;
@@ -125,3 +144,25 @@ double Constraint::optional_delta_error( const std::vector<Variable*>& variables
 }
 
 void Constraint::conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value ) { }
+
+void Constraint::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	_is_optional_filter_domains_defined = false;
+	throw filterDomainsNotDefinedException();
+}
+
+double Constraint::optional_variable_error( const std::vector<Variable*>& variables, int index ) const
+{
+	_is_optional_variable_error_defined = false;
+	throw variableErrorNotDefinedException();
+}
+
+void Constraint::optional_variable_error_changes( const std::vector<Variable*>& variables,
+                                                  int index,
+                                                  int new_value,
+                                                  std::vector<std::pair<int, double>>& error_changes ) const { }
+
+bool Constraint::optional_is_swap_invariant() const
+{
+	return false;
+}
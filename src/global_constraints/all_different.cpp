@@ -29,71 +29,85 @@
 
 #include <cmath>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 
 #include "global_constraints/all_different.hpp"
 
 using ghost::global_constraints::AllDifferent;
 
-double AllDifferent::binomial_with_2( int value ) const
-{
-	if( value <= 1 )
-		return 0;
-	
-	if( value % 2 == 0 )
-		return static_cast<double>( value - 1 ) * ( value / 2 );
-	else
-		return static_cast<double>( value ) * ( ( value - 1 ) / 2 );
-}
-
-
 AllDifferent::AllDifferent( const std::vector<int>& variables_index )
-	: Constraint( variables_index )
+	: Constraint( variables_index ),
+	  _offset( 0 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
 { }
 
 AllDifferent::AllDifferent( const std::vector<Variable>& variables )
-	: Constraint( variables )
+	: Constraint( variables ),
+	  _offset( 0 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
 { }
 
+// Dense counts are used unless domain bounds span more than 4 times the total domain size.
+// The span is computed on 64 bits, since it may not fit in an int.
+void AllDifferent::initialize_counts( const std::vector<Variable*>& variables ) const
+{
+	long long min_value = variables[0]->get_domain_min_value();
+	long long max_value = variables[0]->get_domain_max_value();
+	long long total_size = 0;
+	for( auto v : variables )
+	{
+		min_value = std::min( min_value, static_cast<long long>( v->get_domain_min_value() ) );
+		max_value = std::max( max_value, static_cast<long long>( v->get_domain_max_value() ) );
+		total_size += static_cast<long long>( v->get_domain_size() );
+	}
+
+	long long span = max_value - min_value + 1;
+	_is_dense = span <= 4 * total_size;
+	if( _is_dense )
+	{
+		_offset = static_cast<int>( min_value );
+		_count.resize( static_cast<std::size_t>( span ) );
+	}
+	_is_initialized = true;
+}
+
 // SOFT_ALLDIFF error function (Petit et al. 2001)
+// Each variable taking a value already taken by c other variables adds c conflicts,
+// thus removing a variable from a value taken by c variables removes c-1 conflicts.
 double AllDifferent::required_error( const std::vector<Variable*>& variables ) const
 {
 	double counter = 0;
-	_count.clear();
-	
+
+	if( !_is_initialized )
+		initialize_counts( variables );
+
+	std::fill( _count.begin(), _count.end(), 0 );
+	_sparse_count.clear();
+
 	for( auto v : variables )
-		if( _count.find( v->get_value() ) == _count.end() )
-			_count[ v->get_value() ] = 1;
-		else
-			_count[ v->get_value() ] = _count[ v->get_value() ] + 1;
-	
-	for( const auto& [key, value] : _count )
-		if( value > 1 )
-			counter += binomial_with_2( value );
+		counter += count( v->get_value() )++;
 
 	return counter;
 }
 
+// Changes are applied one by one on _count, then reverted.
 double AllDifferent::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
 {
 	double diff = 0.0;
-	auto copy_count( _count );
 
 	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
 	{
-		copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] = copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] - 1;
-		if( copy_count.count( candidate_values[ i ] ) == 0 )
-			copy_count[ candidate_values[ i ] ] = 1;
-		else
-			copy_count[ candidate_values[ i ] ] = copy_count[ candidate_values[ i ] ] + 1;
+		diff -= --count( variables[ variable_indexes[ i ] ]->get_value() );
+		diff += count( candidate_values[ i ] )++;
 	}
-	
-	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
 	{
-		if( _count[ variables[ variable_indexes[ i ] ]->get_value() ] != copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] )
-			diff += ( binomial_with_2( copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] ) - binomial_with_2( _count[ variables[ variable_indexes[ i ] ]->get_value() ] ) );
-		if( _count[ candidate_values[ i ] ] != copy_count[ candidate_values[ i ] ] )
-			diff += ( binomial_with_2( copy_count[ candidate_values[ i ] ] ) - binomial_with_2( _count[ candidate_values[ i ] ] ) );
+		--count( candidate_values[ i ] );
+		++count( variables[ variable_indexes[ i ] ]->get_value() );
 	}
 
 	return diff;
@@ -101,10 +115,105 @@ double AllDifferent::optional_delta_error( const std::vector<Variable*>& variabl
 
 void AllDifferent::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
 {
-	_count[ variables[ variable_index ]->get_value() ] = _count[ variables[ variable_index ]->get_value() ] - 1;
+	--count( variables[ variable_index ]->get_value() );
+	++count( new_value );
+}
 
-	if( _count.count( new_value ) == 0 )
-		_count[ new_value ] = 1;
-	else
-		_count[ new_value ] = _count[ new_value ] + 1;	
+// Value elimination from singleton domains, followed by bounds consistency on Hall intervals.
+void AllDifferent::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	int size = static_cast<int>( domains.size() );
+	std::vector<int> order( size );
+	std::vector<int> min_values( size );
+	std::vector<int> max_values( size );
+	bool changed = true;
+
+	while( changed )
+	{
+		changed = false;
+
+		// Remove values of assigned variables from other domains
+		for( int i = 0 ; i < size ; ++i )
+		{
+			if( domains[ i ].size() != 1 )
+				continue;
+
+			int value = domains[ i ][ 0 ];
+			for( int j = 0 ; j < size ; ++j )
+			{
+				if( j == i )
+					continue;
+
+				auto position = std::find( domains[ j ].begin(), domains[ j ].end(), value );
+				if( position != domains[ j ].end() )
+				{
+					domains[ j ].erase( position );
+					if( domains[ j ].empty() )
+						return;
+					changed = true;
+				}
+			}
+		}
+
+		if( changed )
+			continue;
+
+		// Look for a Hall interval [a,b], i.e., an interval containing the domains of exactly b-a+1 variables
+		for( int i = 0 ; i < size ; ++i )
+		{
+			auto minmax = std::minmax_element( domains[ i ].begin(), domains[ i ].end() );
+			min_values[ i ] = *minmax.first;
+			max_values[ i ] = *minmax.second;
+		}
+
+		std::iota( order.begin(), order.end(), 0 );
+		std::sort( order.begin(), order.end(), [&]( int i, int j ){ return max_values[ i ] < max_values[ j ]; } );
+
+		for( int a = 0 ; a < size && !changed ; ++a )
+		{
+			int count = 0;
+			for( int index : order )
+			{
+				if( min_values[ index ] < min_values[ a ] )
+					continue;
+
+				++count;
+				int interval_size = max_values[ index ] - min_values[ a ] + 1;
+				if( count > interval_size )
+				{
+					// more variables than values: the constraint cannot be satisfied
+					domains[ index ].clear();
+					return;
+				}
+
+				if( count == interval_size )
+				{
+					for( int j = 0 ; j < size ; ++j )
+					{
+						if( min_values[ j ] >= min_values[ a ] && max_values[ j ] <= max_values[ index ] )
+							continue;
+
+						auto new_end = std::remove_if( domains[ j ].begin(),
+						                               domains[ j ].end(),
+						                               [&]( int value ){ return value >= min_values[ a ] && value <= max_values[ index ]; } );
+						if( new_end != domains[ j ].end() )
+						{
+							domains[ j ].erase( new_end, domains[ j ].end() );
+							if( domains[ j ].empty() )
+								return;
+							changed = true;
+						}
+					}
+
+					if( changed )
+						break;
+				}
+			}
+		}
+	}
+}
+
+bool AllDifferent::optional_is_swap_invariant() const
+{
+	return true;
 }
@@ -30,6 +30,7 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <iterator>
 #include <iostream>
 
 #include "global_constraints/all_equal.hpp"
@@ -37,58 +38,138 @@
 using ghost::global_constraints::AllEqual;
 
 AllEqual::AllEqual( const std::vector<int>& variables_index )
-	: Constraint( variables_index )
+	: Constraint( variables_index ),
+	  _offset( 0 ),
+	  _max_count( 0 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
 { }
 
 AllEqual::AllEqual( const std::vector<Variable>& variables )
-	: Constraint( variables )
+	: Constraint( variables ),
+	  _offset( 0 ),
+	  _max_count( 0 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
 { }
 
+// Like in AllDifferent, counts are sparse if the 64-bit span of domain bounds exceeds 4 times the total domain size.
+void AllEqual::initialize_counts( const std::vector<Variable*>& variables ) const
+{
+	long long min_value = variables[0]->get_domain_min_value();
+	long long max_value = variables[0]->get_domain_max_value();
+	long long total_size = 0;
+	for( auto v : variables )
+	{
+		min_value = std::min( min_value, static_cast<long long>( v->get_domain_min_value() ) );
+		max_value = std::max( max_value, static_cast<long long>( v->get_domain_max_value() ) );
+		total_size += static_cast<long long>( v->get_domain_size() );
+	}
+
+	long long span = max_value - min_value + 1;
+	_is_dense = span <= 4 * total_size;
+	if( _is_dense )
+	{
+		_offset = static_cast<int>( min_value );
+		_count.resize( static_cast<std::size_t>( span ) );
+	}
+	_buckets.resize( variables.size() + 1 );
+	_is_initialized = true;
+}
+
+void AllEqual::increment( int value ) const
+{
+	int& value_count = count( value );
+	--_buckets[ value_count ];
+	++value_count;
+	++_buckets[ value_count ];
+
+	if( value_count > _max_count )
+		_max_count = value_count;
+}
+
+void AllEqual::decrement( int value ) const
+{
+	int& value_count = count( value );
+	--_buckets[ value_count ];
+	if( value_count == _max_count && _buckets[ value_count ] == 0 )
+		--_max_count;
+	--value_count;
+	++_buckets[ value_count ];
+}
+
 double AllEqual::required_error( const std::vector<Variable*>& variables ) const
 {
-	_count.clear();
+	if( !_is_initialized )
+		initialize_counts( variables );
+
+	std::fill( _count.begin(), _count.end(), 0 );
+	_sparse_count.clear();
+	std::fill( _buckets.begin(), _buckets.end(), 0 );
+	// _buckets[ 0 ] is never read: values of counted variables have a count of at least 1.
+	_buckets[ 0 ] = static_cast<int>( _count.size() );
+	_max_count = 0;
 	
 	for( auto v : variables )
-		if( _count.find( v->get_value() ) == _count.end() )
-			_count[ v->get_value() ] = 1;
-		else
-			_count[ v->get_value() ] = _count[ v->get_value() ] + 1;
-
-	auto max = std::max_element( _count.begin(), _count.end(), [](const auto& c1, const auto& c2){ return c1.second < c2.second; } );
+		increment( v->get_value() );
 
-	return static_cast<double>( variables.size() ) - max->second;
+	return static_cast<double>( variables.size() ) - _max_count;
 }
 
+// Changes are applied one by one on frequencies, then reverted. Each change updates the maximal frequency in O(1).
 double AllEqual::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
 {
-	// Warning: we may have several values with the same maximal count. How to handle that in a smart way?
+	int current_max_count = _max_count;
 
-	auto copy_count( _count );
-	auto max = std::max_element( _count.begin(), _count.end(), [](const auto& c1, const auto& c2){ return c1.second < c2.second; } );
-
-	//int number_substraction = std::count( variable_indexes.begin(), variable_indexes.end(), [&](const auto& i){ return variables[ i ]->get_value() == max->first; } );
-	//int number_addition = std::count( candidate_values.begin(), candidate_values.end(), [&](const int v){ return v == max->first; } );
-	
 	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
 	{
-		copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] = copy_count[ variables[ variable_indexes[ i ] ]->get_value() ] - 1;
-		if( copy_count.count( candidate_values[ i ] ) == 0 )
-			copy_count[ candidate_values[ i ] ] = 1;
-		else
-			copy_count[ candidate_values[ i ] ] = copy_count[ candidate_values[ i ] ] + 1;
+		decrement( variables[ variable_indexes[ i ] ]->get_value() );
+		increment( candidate_values[ i ] );
 	}
 
-	auto max_bis = std::max_element( copy_count.begin(), copy_count.end(), [](const auto& c1, const auto& c2){ return c1.second < c2.second; } );
-	
-	return static_cast<double>( max->second - max_bis->second );
+	int new_max_count = _max_count;
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+	{
+		decrement( candidate_values[ i ] );
+		increment( variables[ variable_indexes[ i ] ]->get_value() );
+	}
+
+	return static_cast<double>( current_max_count - new_max_count );
 }
 
 void AllEqual::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
 {
-	_count[ variables[ variable_index ]->get_value() ] = _count[ variables[ variable_index ]->get_value() ] - 1;
+	decrement( variables[ variable_index ]->get_value() );
+	increment( new_value );
+}
+
+void AllEqual::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	// All variables must share a value: keep the intersection of all domains
+	std::vector<int> intersection( domains[ 0 ] );
+	std::sort( intersection.begin(), intersection.end() );
+
+	for( int i = 1 ; i < static_cast<int>( domains.size() ) && !intersection.empty() ; ++i )
+	{
+		std::vector<int> sorted_domain( domains[ i ] );
+		std::sort( sorted_domain.begin(), sorted_domain.end() );
+
+		std::vector<int> new_intersection;
+		std::set_intersection( intersection.begin(), intersection.end(),
+		                       sorted_domain.begin(), sorted_domain.end(),
+		                       std::back_inserter( new_intersection ) );
+		intersection.swap( new_intersection );
+	}
+
+	for( auto& domain : domains )
+		domain.erase( std::remove_if( domain.begin(),
+		                              domain.end(),
+		                              [&]( int value ){ return !std::binary_search( intersection.begin(), intersection.end(), value ); } ),
+		              domain.end() );
+}
 
-	if( _count.count( new_value ) == 0 )
-		_count[ new_value ] = 1;
-	else
-		_count[ new_value ] = _count[ new_value ] + 1;	
+bool AllEqual::optional_is_swap_invariant() const
+{
+	return true;
 }
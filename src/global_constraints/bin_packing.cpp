@@ -0,0 +1,233 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include "global_constraints/bin_packing.hpp"
+
+using ghost::global_constraints::BinPacking;
+
+BinPacking::BinPacking( const std::vector<int>& variables_index,
+                        const std::vector<int>& sizes,
+                        const std::vector<int>& capacities )
+	: Constraint( variables_index ),
+	  _sizes( sizes ),
+	  _capacities( capacities ),
+	  _bins( variables_index.size() ),
+	  _loads( capacities.size() ),
+	  _bin_items( capacities.size() ),
+	  _item_slots( variables_index.size() )
+{
+	if( _sizes.size() != variables_index.size() )
+		throw sizeException( static_cast<int>( _sizes.size() ), static_cast<int>( variables_index.size() ) );
+}
+
+BinPacking::BinPacking( const std::vector<Variable>& variables,
+                        const std::vector<int>& sizes,
+                        const std::vector<int>& capacities )
+	: Constraint( variables ),
+	  _sizes( sizes ),
+	  _capacities( capacities ),
+	  _bins( variables.size() ),
+	  _loads( capacities.size() ),
+	  _bin_items( capacities.size() ),
+	  _item_slots( variables.size() )
+{
+	if( _sizes.size() != variables.size() )
+		throw sizeException( static_cast<int>( _sizes.size() ), static_cast<int>( variables.size() ) );
+}
+
+bool BinPacking::is_bin( int bin ) const
+{
+	return bin >= 0 && bin < static_cast<int>( _capacities.size() );
+}
+
+long long BinPacking::overflow( int bin, long long load ) const
+{
+	return std::max( 0LL, load - _capacities[ bin ] );
+}
+
+void BinPacking::remove_item( int item ) const
+{
+	int bin = _bins[ item ];
+	if( !is_bin( bin ) )
+		return;
+
+	_loads[ bin ] -= _sizes[ item ];
+
+	auto& items = _bin_items[ bin ];
+	items[ _item_slots[ item ] ] = items.back();
+	_item_slots[ items.back() ] = _item_slots[ item ];
+	items.pop_back();
+}
+
+void BinPacking::insert_item( int item, int bin ) const
+{
+	_bins[ item ] = bin;
+	if( !is_bin( bin ) )
+		return;
+
+	_loads[ bin ] += _sizes[ item ];
+	_item_slots[ item ] = static_cast<int>( _bin_items[ bin ].size() );
+	_bin_items[ bin ].push_back( item );
+}
+
+double BinPacking::required_error( const std::vector<Variable*>& variables ) const
+{
+	std::fill( _loads.begin(), _loads.end(), 0 );
+	for( auto& items : _bin_items )
+		items.clear();
+
+	long long error = 0;
+	for( int item = 0 ; item < static_cast<int>( variables.size() ) ; ++item )
+	{
+		insert_item( item, variables[ item ]->get_value() );
+		if( !is_bin( _bins[ item ] ) )
+			error += _sizes[ item ];
+	}
+
+	for( int bin = 0 ; bin < static_cast<int>( _capacities.size() ) ; ++bin )
+		error += overflow( bin, _loads[ bin ] );
+
+	return static_cast<double>( error );
+}
+
+double BinPacking::optional_delta_error( const std::vector<Variable*>& variables,
+                                         const std::vector<int>& variable_indexes,
+                                         const std::vector<int>& candidate_values ) const
+{
+	// Load changes of the bins involved in the move
+	std::vector<std::pair<int, long long>> load_changes;
+	auto add_load = [&]( int bin, long long size )
+	{
+		auto it = std::find_if( load_changes.begin(), load_changes.end(), [&]( const auto& change ){ return change.first == bin; } );
+		if( it == load_changes.end() )
+			load_changes.emplace_back( bin, size );
+		else
+			it->second += size;
+	};
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int item = variable_indexes[ i ];
+		add_load( _bins[ item ], -_sizes[ item ] );
+		add_load( candidate_values[ i ], _sizes[ item ] );
+	}
+
+	long long delta = 0;
+	for( const auto& change : load_changes )
+		if( is_bin( change.first ) )
+			delta += overflow( change.first, _loads[ change.first ] + change.second ) - overflow( change.first, _loads[ change.first ] );
+		else
+			delta += change.second;
+
+	return static_cast<double>( delta );
+}
+
+void BinPacking::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	remove_item( variable_index );
+	insert_item( variable_index, new_value );
+}
+
+// Bins where an item does not fit anymore given items with a fixed bin are removed from its domain.
+void BinPacking::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	std::vector<long long> fixed_loads( _capacities.size(), 0 );
+	for( int item = 0 ; item < static_cast<int>( domains.size() ) ; ++item )
+		if( domains[ item ].size() == 1 && is_bin( domains[ item ][0] ) )
+			fixed_loads[ domains[ item ][0] ] += _sizes[ item ];
+
+	for( int item = 0 ; item < static_cast<int>( domains.size() ) ; ++item )
+	{
+		auto& domain = domains[ item ];
+		bool is_fixed = domain.size() == 1;
+
+		domain.erase( std::remove_if( domain.begin(),
+		                              domain.end(),
+		                              [&]( int bin )
+		                              {
+			                              if( !is_bin( bin ) )
+				                              return _sizes[ item ] > 0;
+			                              return fixed_loads[ bin ] + ( is_fixed ? 0 : _sizes[ item ] ) > _capacities[ bin ];
+		                              } ),
+		              domain.end() );
+
+		if( domain.empty() )
+			return;
+	}
+}
+
+bool BinPacking::optional_is_swap_invariant() const
+{
+	return std::adjacent_find( _sizes.cbegin(), _sizes.cend(), std::not_equal_to<int>() ) == _sizes.cend();
+}
+
+double BinPacking::optional_variable_error( const std::vector<Variable*>& variables, int index ) const
+{
+	int bin = _bins[ index ];
+	return static_cast<double>( is_bin( bin ) ? overflow( bin, _loads[ bin ] ) : _sizes[ index ] );
+}
+
+void BinPacking::optional_variable_error_changes( const std::vector<Variable*>& variables,
+                                                  int index,
+                                                  int new_value,
+                                                  std::vector<std::pair<int, double>>& error_changes ) const
+{
+	int old_bin = _bins[ index ];
+	if( old_bin == new_value )
+		return;
+
+	double old_error = optional_variable_error( variables, index );
+
+	if( is_bin( old_bin ) )
+	{
+		double change = static_cast<double>( overflow( old_bin, _loads[ old_bin ] - _sizes[ index ] ) - overflow( old_bin, _loads[ old_bin ] ) );
+		if( change != 0.0 )
+			for( int item : _bin_items[ old_bin ] )
+				if( item != index )
+					error_changes.emplace_back( item, change );
+	}
+
+	double new_error = static_cast<double>( _sizes[ index ] );
+	if( is_bin( new_value ) )
+	{
+		long long old_overflow = overflow( new_value, _loads[ new_value ] );
+		long long new_overflow = overflow( new_value, _loads[ new_value ] + _sizes[ index ] );
+		new_error = static_cast<double>( new_overflow );
+
+		if( new_overflow != old_overflow )
+			for( int item : _bin_items[ new_value ] )
+				error_changes.emplace_back( item, static_cast<double>( new_overflow - old_overflow ) );
+	}
+
+	if( new_error != old_error )
+		error_changes.emplace_back( index, new_error - old_error );
+}
@@ -0,0 +1,274 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "global_constraints/clauses.hpp"
+
+using ghost::global_constraints::Clauses;
+
+Clauses::Clauses( const std::vector<int>& variables_index, const std::vector<std::vector<int>>& clauses )
+	: Constraint( variables_index )
+{
+	initialize_clauses( clauses, static_cast<int>( variables_index.size() ) );
+}
+
+Clauses::Clauses( const std::vector<Variable>& variables, const std::vector<std::vector<int>>& clauses )
+	: Constraint( variables )
+{
+	initialize_clauses( clauses, static_cast<int>( variables.size() ) );
+}
+
+void Clauses::initialize_clauses( const std::vector<std::vector<int>>& clauses, int number_variables )
+{
+	_clause_offsets.push_back( 0 );
+	_occurrence_offsets.assign( number_variables + 1, 0 );
+
+	for( int clause_index = 0 ; clause_index < static_cast<int>( clauses.size() ) ; ++clause_index )
+	{
+		const auto& clause = clauses[ clause_index ];
+		if( clause.empty() )
+			throw emptyClauseException( clause_index );
+
+		for( int literal : clause )
+			if( literal == 0 || std::abs( static_cast<long long>( literal ) ) > number_variables )
+				throw literalException( clause_index, literal, number_variables );
+
+		// Duplicated literals are removed, and tautologies (clauses containing x and not x) are discarded.
+		std::vector<int> literals( clause );
+		std::sort( literals.begin(), literals.end() );
+		literals.erase( std::unique( literals.begin(), literals.end() ), literals.end() );
+
+		bool is_tautology = std::any_of( literals.begin(), literals.end(), [&]( int literal ){ return literal > 0 && std::binary_search( literals.begin(), literals.end(), -literal ); } );
+		if( is_tautology )
+			continue;
+
+		for( int literal : literals )
+		{
+			_literals.push_back( literal );
+			++_occurrence_offsets[ std::abs( literal ) ];
+		}
+		_clause_offsets.push_back( static_cast<int>( _literals.size() ) );
+	}
+
+	for( int i = 0 ; i < number_variables ; ++i )
+		_occurrence_offsets[ i + 1 ] += _occurrence_offsets[ i ];
+
+	int number_clauses = static_cast<int>( _clause_offsets.size() ) - 1;
+	_occurrences.resize( _literals.size() );
+	std::vector<int> next( _occurrence_offsets.begin(), _occurrence_offsets.end() - 1 );
+	for( int c = 0 ; c < number_clauses ; ++c )
+		for( int l = _clause_offsets[ c ] ; l < _clause_offsets[ c + 1 ] ; ++l )
+			_occurrences[ next[ std::abs( _literals[ l ] ) - 1 ]++ ] = _literals[ l ] > 0 ? c + 1 : -( c + 1 );
+
+	_truth_values.resize( number_variables );
+	_true_count.resize( number_clauses );
+	_true_xor.resize( number_clauses );
+	_break.resize( number_variables );
+	_make.resize( number_variables );
+}
+
+bool Clauses::literal_is_true( int literal ) const
+{
+	return _truth_values[ std::abs( literal ) - 1 ] == ( literal > 0 );
+}
+
+// Flip variables[ index ], updating true literal counts as well as break and make scores.
+void Clauses::flip( int index ) const
+{
+	_truth_values[ index ] = !_truth_values[ index ];
+
+	for( int o = _occurrence_offsets[ index ] ; o < _occurrence_offsets[ index + 1 ] ; ++o )
+	{
+		int clause = std::abs( _occurrences[ o ] ) - 1;
+		bool becomes_true = _truth_values[ index ] == ( _occurrences[ o ] > 0 );
+
+		if( becomes_true )
+		{
+			if( _true_count[ clause ] == 0 )
+			{
+				for( int l = _clause_offsets[ clause ] ; l < _clause_offsets[ clause + 1 ] ; ++l )
+					--_make[ std::abs( _literals[ l ] ) - 1 ];
+				++_break[ index ];
+			}
+			else if( _true_count[ clause ] == 1 )
+				--_break[ _true_xor[ clause ] ];
+
+			++_true_count[ clause ];
+			_true_xor[ clause ] ^= index;
+		}
+		else
+		{
+			--_true_count[ clause ];
+			_true_xor[ clause ] ^= index;
+
+			if( _true_count[ clause ] == 0 )
+			{
+				--_break[ index ];
+				for( int l = _clause_offsets[ clause ] ; l < _clause_offsets[ clause + 1 ] ; ++l )
+					++_make[ std::abs( _literals[ l ] ) - 1 ];
+			}
+			else if( _true_count[ clause ] == 1 )
+				++_break[ _true_xor[ clause ] ];
+		}
+	}
+}
+
+double Clauses::required_error( const std::vector<Variable*>& variables ) const
+{
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+		_truth_values[ i ] = variables[ i ]->get_value() != 0;
+
+	std::fill( _break.begin(), _break.end(), 0 );
+	std::fill( _make.begin(), _make.end(), 0 );
+
+	int unsatisfied = 0;
+	for( int c = 0 ; c < static_cast<int>( _true_count.size() ) ; ++c )
+	{
+		_true_count[ c ] = 0;
+		_true_xor[ c ] = 0;
+		for( int l = _clause_offsets[ c ] ; l < _clause_offsets[ c + 1 ] ; ++l )
+			if( literal_is_true( _literals[ l ] ) )
+			{
+				++_true_count[ c ];
+				_true_xor[ c ] ^= std::abs( _literals[ l ] ) - 1;
+			}
+
+		if( _true_count[ c ] == 0 )
+		{
+			++unsatisfied;
+			for( int l = _clause_offsets[ c ] ; l < _clause_offsets[ c + 1 ] ; ++l )
+				++_make[ std::abs( _literals[ l ] ) - 1 ];
+		}
+		else if( _true_count[ c ] == 1 )
+			++_break[ _true_xor[ c ] ];
+	}
+
+	return static_cast<double>( unsatisfied );
+}
+
+double Clauses::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
+{
+	if( variable_indexes.size() == 1 )
+	{
+		int index = variable_indexes[0];
+		if( _truth_values[ index ] == ( candidate_values[0] != 0 ) )
+			return 0.0;
+
+		return static_cast<double>( _break[ index ] - _make[ index ] );
+	}
+
+	// Otherwise, variables are flipped one by one, then flipped back.
+	int delta = 0;
+	std::vector<int> flipped;
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int index = variable_indexes[ i ];
+		if( _truth_values[ index ] != ( candidate_values[ i ] != 0 ) )
+		{
+			delta += _break[ index ] - _make[ index ];
+			flip( index );
+			flipped.push_back( index );
+		}
+	}
+
+	for( auto it = flipped.rbegin() ; it != flipped.rend() ; ++it )
+		flip( *it );
+
+	return static_cast<double>( delta );
+}
+
+void Clauses::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	if( _truth_values[ variable_index ] != ( new_value != 0 ) )
+		flip( variable_index );
+}
+
+// Unit propagation: a clause with only one literal that can still be true forces this literal.
+void Clauses::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	auto can_be = [&]( int index, bool truth_value ){ return std::any_of( domains[ index ].begin(), domains[ index ].end(), [&]( int value ){ return ( value != 0 ) == truth_value; } ); };
+
+	for( int c = 0 ; c < static_cast<int>( _true_count.size() ) ; ++c )
+	{
+		int possibly_true = 0;
+		int last_literal = 0;
+
+		for( int l = _clause_offsets[ c ] ; l < _clause_offsets[ c + 1 ] && possibly_true < 2 ; ++l )
+			if( can_be( std::abs( _literals[ l ] ) - 1, _literals[ l ] > 0 ) )
+			{
+				++possibly_true;
+				last_literal = _literals[ l ];
+			}
+
+		if( possibly_true == 0 )
+		{
+			domains[ std::abs( _literals[ _clause_offsets[ c ] ] ) - 1 ].clear();
+			return;
+		}
+
+		if( possibly_true == 1 )
+		{
+			auto& domain = domains[ std::abs( last_literal ) - 1 ];
+			domain.erase( std::remove_if( domain.begin(), domain.end(), [&]( int value ){ return ( value != 0 ) != ( last_literal > 0 ); } ), domain.end() );
+		}
+	}
+}
+
+double Clauses::optional_variable_error( const std::vector<Variable*>& variables, int index ) const
+{
+	return static_cast<double>( _make[ index ] );
+}
+
+void Clauses::optional_variable_error_changes( const std::vector<Variable*>& variables,
+                                               int index,
+                                               int new_value,
+                                               std::vector<std::pair<int, double>>& error_changes ) const
+{
+	if( _truth_values[ index ] == ( new_value != 0 ) )
+		return;
+
+	// Make scores change for variables of clauses becoming satisfied or unsatisfied
+	for( int o = _occurrence_offsets[ index ] ; o < _occurrence_offsets[ index + 1 ] ; ++o )
+	{
+		int clause = std::abs( _occurrences[ o ] ) - 1;
+		bool becomes_true = !_truth_values[ index ] == ( _occurrences[ o ] > 0 );
+
+		double change = 0.0;
+		if( becomes_true && _true_count[ clause ] == 0 )
+			change = -1.0;
+		else if( !becomes_true && _true_count[ clause ] == 1 )
+			change = 1.0;
+
+		if( change != 0.0 )
+			for( int l = _clause_offsets[ clause ] ; l < _clause_offsets[ clause + 1 ] ; ++l )
+				error_changes.emplace_back( std::abs( _literals[ l ] ) - 1, change );
+	}
+}
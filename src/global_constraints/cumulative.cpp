@@ -0,0 +1,219 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include "global_constraints/cumulative.hpp"
+
+using ghost::global_constraints::Cumulative;
+
+Cumulative::Cumulative( const std::vector<int>& variables_index,
+                        const std::vector<int>& durations,
+                        const std::vector<int>& demands,
+                        int capacity )
+	: Constraint( variables_index ),
+	  _durations( durations ),
+	  _demands( demands ),
+	  _capacity( capacity ),
+	  _horizon_start( 0 ),
+	  _horizon( 0 )
+{
+	check_sizes( static_cast<int>( variables_index.size() ) );
+}
+
+Cumulative::Cumulative( const std::vector<Variable>& variables,
+                        const std::vector<int>& durations,
+                        const std::vector<int>& demands,
+                        int capacity )
+	: Constraint( variables ),
+	  _durations( durations ),
+	  _demands( demands ),
+	  _capacity( capacity ),
+	  _horizon_start( 0 ),
+	  _horizon( 0 )
+{
+	check_sizes( static_cast<int>( variables.size() ) );
+}
+
+void Cumulative::check_sizes( int number_tasks ) const
+{
+	if( static_cast<int>( _durations.size() ) != number_tasks )
+		throw sizeException( "durations", static_cast<int>( _durations.size() ), number_tasks );
+
+	if( static_cast<int>( _demands.size() ) != number_tasks )
+		throw sizeException( "demands", static_cast<int>( _demands.size() ), number_tasks );
+}
+
+long long Cumulative::overload( long long load ) const
+{
+	return std::max( 0LL, load - _capacity );
+}
+
+void Cumulative::add( int node, int node_left, int node_right, int left, int right, long long value ) const
+{
+	if( right <= node_left || node_right <= left )
+		return;
+
+	if( left <= node_left && node_right <= right )
+	{
+		_tree_min[ node ] += value;
+		_tree_max[ node ] += value;
+		_tree_lazy[ node ] += value;
+		return;
+	}
+
+	int middle = ( node_left + node_right ) / 2;
+	add( 2 * node, node_left, middle, left, right, value );
+	add( 2 * node + 1, middle, node_right, left, right, value );
+
+	_tree_min[ node ] = std::min( _tree_min[ 2 * node ], _tree_min[ 2 * node + 1 ] ) + _tree_lazy[ node ];
+	_tree_max[ node ] = std::max( _tree_max[ 2 * node ], _tree_max[ 2 * node + 1 ] ) + _tree_lazy[ node ];
+}
+
+long long Cumulative::overload_change( int node, int node_left, int node_right, int left, int right, long long value, long long pending ) const
+{
+	if( right <= node_left || node_right <= left || value == 0 )
+		return 0;
+
+	long long min_load = _tree_min[ node ] + pending;
+	long long max_load = _tree_max[ node ] + pending;
+
+	if( left <= node_left && node_right <= right )
+	{
+		long long length = node_right - node_left;
+
+		if( min_load == max_load )
+			return length * ( overload( min_load + value ) - overload( min_load ) );
+
+		// The whole range stays under the capacity
+		if( std::max( max_load, max_load + value ) <= _capacity )
+			return 0;
+
+		// The whole range stays over the capacity
+		if( std::min( min_load, min_load + value ) >= _capacity )
+			return length * value;
+	}
+
+	int middle = ( node_left + node_right ) / 2;
+	pending += _tree_lazy[ node ];
+	return overload_change( 2 * node, node_left, middle, left, right, value, pending )
+		+ overload_change( 2 * node + 1, middle, node_right, left, right, value, pending );
+}
+
+long long Cumulative::total_overload( int node, int node_left, int node_right, long long pending ) const
+{
+	long long min_load = _tree_min[ node ] + pending;
+	long long max_load = _tree_max[ node ] + pending;
+
+	if( max_load <= _capacity )
+		return 0;
+
+	if( min_load == max_load )
+		return ( node_right - node_left ) * overload( min_load );
+
+	int middle = ( node_left + node_right ) / 2;
+	pending += _tree_lazy[ node ];
+	return total_overload( 2 * node, node_left, middle, pending ) + total_overload( 2 * node + 1, middle, node_right, pending );
+}
+
+void Cumulative::add_task( int task, int start, long long sign ) const
+{
+	add( 1, 0, _horizon, start - _horizon_start, start - _horizon_start + _durations[ task ], sign * _demands[ task ] );
+}
+
+long long Cumulative::task_overload_change( int task, int start, long long sign ) const
+{
+	return overload_change( 1, 0, _horizon, start - _horizon_start, start - _horizon_start + _durations[ task ], sign * _demands[ task ], 0 );
+}
+
+double Cumulative::required_error( const std::vector<Variable*>& variables ) const
+{
+	if( _tree_min.empty() )
+	{
+		int min_start = variables[0]->get_domain_min_value();
+		int max_end = variables[0]->get_domain_max_value() + _durations[0];
+		for( int i = 1 ; i < static_cast<int>( variables.size() ) ; ++i )
+		{
+			min_start = std::min( min_start, variables[i]->get_domain_min_value() );
+			max_end = std::max( max_end, variables[i]->get_domain_max_value() + _durations[i] );
+		}
+
+		_horizon_start = min_start;
+		_horizon = std::max( 1, max_end - min_start );
+		_tree_min.resize( 4 * _horizon );
+		_tree_max.resize( 4 * _horizon );
+		_tree_lazy.resize( 4 * _horizon );
+	}
+
+	std::fill( _tree_min.begin(), _tree_min.end(), 0 );
+	std::fill( _tree_max.begin(), _tree_max.end(), 0 );
+	std::fill( _tree_lazy.begin(), _tree_lazy.end(), 0 );
+
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+		add_task( i, variables[i]->get_value(), 1 );
+
+	return static_cast<double>( total_overload( 1, 0, _horizon, 0 ) );
+}
+
+// Tasks are moved one by one in the load profile, accumulating overload changes, then moved back.
+double Cumulative::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
+{
+	long long delta = 0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int task = variable_indexes[ i ];
+		delta += task_overload_change( task, variables[ task ]->get_value(), -1 );
+		add_task( task, variables[ task ]->get_value(), -1 );
+		delta += task_overload_change( task, candidate_values[ i ], 1 );
+		add_task( task, candidate_values[ i ], 1 );
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+	{
+		int task = variable_indexes[ i ];
+		add_task( task, candidate_values[ i ], -1 );
+		add_task( task, variables[ task ]->get_value(), 1 );
+	}
+
+	return static_cast<double>( delta );
+}
+
+void Cumulative::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	add_task( variable_index, variables[ variable_index ]->get_value(), -1 );
+	add_task( variable_index, new_value, 1 );
+}
+
+bool Cumulative::optional_is_swap_invariant() const
+{
+	return std::adjacent_find( _durations.cbegin(), _durations.cend(), std::not_equal_to<int>() ) == _durations.cend()
+		&& std::adjacent_find( _demands.cbegin(), _demands.cend(), std::not_equal_to<int>() ) == _demands.cend();
+}
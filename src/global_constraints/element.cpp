@@ -0,0 +1,137 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <unordered_set>
+
+#include "global_constraints/element.hpp"
+
+using ghost::Variable;
+using ghost::global_constraints::Element;
+
+namespace
+{
+	template<typename T>
+	std::vector<T> element_scope( const std::vector<T>& array, const T& index_variable, const T& value_variable )
+	{
+		std::vector<T> scope( array );
+		scope.push_back( index_variable );
+		scope.push_back( value_variable );
+		return scope;
+	}
+}
+
+Element::Element( const std::vector<int>& array_index, int index_variable, int value_variable, int index_offset )
+	: Constraint( element_scope( array_index, index_variable, value_variable ) ),
+	  _array_size( static_cast<int>( array_index.size() ) ),
+	  _index_offset( index_offset )
+{
+	if( _array_size == 0 )
+		throw emptyArrayException();
+}
+
+Element::Element( const std::vector<Variable>& array, const Variable& index_variable, const Variable& value_variable, int index_offset )
+	: Constraint( element_scope( array, index_variable, value_variable ) ),
+	  _array_size( static_cast<int>( array.size() ) ),
+	  _index_offset( index_offset )
+{
+	if( _array_size == 0 )
+		throw emptyArrayException();
+}
+
+// Error given the value of z, the value of x[k] with k the closest valid index to z, and the value of y.
+int Element::error_of( int index_value, int element_value, int value ) const
+{
+	int index = index_value - _index_offset;
+	int distance = index < 0 ? -index : std::max( 0, index - _array_size + 1 );
+	return std::abs( element_value - value ) + distance;
+}
+
+double Element::required_error( const std::vector<Variable*>& variables ) const
+{
+	int index_value = variables[ _array_size ]->get_value();
+	int index = std::clamp( index_value - _index_offset, 0, _array_size - 1 );
+
+	return static_cast<double>( error_of( index_value, variables[ index ]->get_value(), variables[ _array_size + 1 ]->get_value() ) );
+}
+
+double Element::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	auto new_value = [&]( int position )
+	{
+		for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+			if( variable_indexes[ i ] == position )
+				return candidate_values[ i ];
+		return variables[ position ]->get_value();
+	};
+
+	int new_index_value = new_value( _array_size );
+	int new_index = std::clamp( new_index_value - _index_offset, 0, _array_size - 1 );
+
+	return static_cast<double>( error_of( new_index_value, new_value( new_index ), new_value( _array_size + 1 ) ) ) - required_error( variables );
+}
+
+void Element::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	auto& index_domain = domains[ _array_size ];
+	auto& value_domain = domains[ _array_size + 1 ];
+
+	std::unordered_set<int> possible_values( value_domain.begin(), value_domain.end() );
+
+	// z can only refer to elements of x sharing a value with y
+	index_domain.erase( std::remove_if( index_domain.begin(),
+	                                    index_domain.end(),
+	                                    [&]( int index_value )
+	                                    {
+		                                    int index = index_value - _index_offset;
+		                                    return index < 0 || index >= _array_size
+			                                    || std::none_of( domains[ index ].begin(), domains[ index ].end(), [&]( int value ){ return possible_values.count( value ) > 0; } );
+	                                    } ),
+	                    index_domain.end() );
+
+	// y can only take values of elements that z can refer to
+	possible_values.clear();
+	for( int index_value : index_domain )
+		possible_values.insert( domains[ index_value - _index_offset ].begin(), domains[ index_value - _index_offset ].end() );
+
+	value_domain.erase( std::remove_if( value_domain.begin(), value_domain.end(), [&]( int value ){ return possible_values.count( value ) == 0; } ),
+	                    value_domain.end() );
+
+	// if z is fixed, the referred element must take a value of y
+	if( index_domain.size() == 1 )
+	{
+		possible_values = std::unordered_set<int>( value_domain.begin(), value_domain.end() );
+		auto& element_domain = domains[ index_domain[0] - _index_offset ];
+		element_domain.erase( std::remove_if( element_domain.begin(), element_domain.end(), [&]( int value ){ return possible_values.count( value ) == 0; } ),
+		                      element_domain.end() );
+	}
+}
@@ -28,6 +28,7 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 #include "global_constraints/fix_value.hpp"
 
@@ -62,3 +63,17 @@ double FixValue::optional_delta_error( const std::vector<Variable*>& variables,
 	
 	return diff;
 } 
+
+void FixValue::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	for( auto& domain : domains )
+		if( std::find( domain.begin(), domain.end(), _value ) == domain.end() )
+			domain.clear();
+		else
+			domain.assign( 1, _value );
+}
+
+bool FixValue::optional_is_swap_invariant() const
+{
+	return true;
+}
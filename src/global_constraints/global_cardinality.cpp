@@ -0,0 +1,236 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_constraints/global_cardinality.hpp"
+
+using ghost::global_constraints::GlobalCardinality;
+
+GlobalCardinality::GlobalCardinality( const std::vector<int>& variables_index,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& min_counts,
+                                      const std::vector<int>& max_counts )
+	: Constraint( variables_index ),
+	  _min_counts( min_counts ),
+	  _max_counts( max_counts ),
+	  _offset( 0 ),
+	  _count( values.size(), 0 )
+{
+	initialize_slots( values );
+}
+
+GlobalCardinality::GlobalCardinality( const std::vector<int>& variables_index,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& counts )
+	: GlobalCardinality( variables_index, values, counts, counts )
+{ }
+
+GlobalCardinality::GlobalCardinality( const std::vector<Variable>& variables,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& min_counts,
+                                      const std::vector<int>& max_counts )
+	: Constraint( variables ),
+	  _min_counts( min_counts ),
+	  _max_counts( max_counts ),
+	  _offset( 0 ),
+	  _count( values.size(), 0 )
+{
+	initialize_slots( values );
+}
+
+GlobalCardinality::GlobalCardinality( const std::vector<Variable>& variables,
+                                      const std::vector<int>& values,
+                                      const std::vector<int>& counts )
+	: GlobalCardinality( variables, values, counts, counts )
+{ }
+
+void GlobalCardinality::initialize_slots( const std::vector<int>& values )
+{
+	if( _min_counts.size() != values.size() )
+		throw sizeException( "minimal counts", static_cast<int>( _min_counts.size() ), static_cast<int>( values.size() ) );
+
+	if( _max_counts.size() != values.size() )
+		throw sizeException( "maximal counts", static_cast<int>( _max_counts.size() ), static_cast<int>( values.size() ) );
+
+	if( values.empty() )
+		return;
+
+	auto minmax = std::minmax_element( values.begin(), values.end() );
+	_offset = *minmax.first;
+	_slots.resize( *minmax.second - *minmax.first + 1, -1 );
+
+	for( int i = 0 ; i < static_cast<int>( values.size() ) ; ++i )
+	{
+		if( _slots[ values[ i ] - _offset ] != -1 )
+			throw duplicatedValueException( values[ i ] );
+
+		_slots[ values[ i ] - _offset ] = i;
+	}
+}
+
+int GlobalCardinality::slot( int value ) const
+{
+	int index = value - _offset;
+	if( index < 0 || index >= static_cast<int>( _slots.size() ) )
+		return -1;
+
+	return _slots[ index ];
+}
+
+int GlobalCardinality::slot_error( int slot, int count ) const
+{
+	return std::max( 0, _min_counts[ slot ] - count ) + std::max( 0, count - _max_counts[ slot ] );
+}
+
+int GlobalCardinality::increment( int value ) const
+{
+	int s = slot( value );
+	if( s == -1 )
+		return 0;
+
+	int& count = _count[ s ];
+	++count;
+	return slot_error( s, count ) - slot_error( s, count - 1 );
+}
+
+int GlobalCardinality::decrement( int value ) const
+{
+	int s = slot( value );
+	if( s == -1 )
+		return 0;
+
+	int& count = _count[ s ];
+	--count;
+	return slot_error( s, count ) - slot_error( s, count + 1 );
+}
+
+double GlobalCardinality::required_error( const std::vector<Variable*>& variables ) const
+{
+	std::fill( _count.begin(), _count.end(), 0 );
+
+	for( auto v : variables )
+	{
+		int s = slot( v->get_value() );
+		if( s != -1 )
+			++_count[ s ];
+	}
+
+	int error = 0;
+	for( int s = 0 ; s < static_cast<int>( _count.size() ) ; ++s )
+		error += slot_error( s, _count[ s ] );
+
+	return static_cast<double>( error );
+}
+
+// Changes are applied one by one on counts, each giving its error change in O(1), then reverted.
+double GlobalCardinality::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
+{
+	int delta = 0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		delta += decrement( variables[ variable_indexes[ i ] ]->get_value() );
+		delta += increment( candidate_values[ i ] );
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+	{
+		decrement( candidate_values[ i ] );
+		increment( variables[ variable_indexes[ i ] ]->get_value() );
+	}
+
+	return static_cast<double>( delta );
+}
+
+void GlobalCardinality::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	decrement( variables[ variable_index ]->get_value() );
+	increment( new_value );
+}
+
+void GlobalCardinality::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	// For each given value, count variables that must take it (singleton domains) and variables that can take it.
+	std::vector<int> fixed( _count.size(), 0 );
+	std::vector<int> possible( _count.size(), 0 );
+
+	for( auto& domain : domains )
+		for( int value : domain )
+		{
+			int s = slot( value );
+			if( s != -1 )
+			{
+				++possible[ s ];
+				if( domain.size() == 1 )
+					++fixed[ s ];
+			}
+		}
+
+	for( int s = 0 ; s < static_cast<int>( _count.size() ) ; ++s )
+		if( fixed[ s ] > _max_counts[ s ] || possible[ s ] < _min_counts[ s ] )
+		{
+			domains[ 0 ].clear();
+			return;
+		}
+
+	for( auto& domain : domains )
+	{
+		if( domain.size() == 1 )
+			continue;
+
+		// If a value must be taken by all variables that can take it, fix them to this value.
+		// Two such values for the same variable cannot be both satisfied.
+		auto is_forced = [&]( int value ){ int s = slot( value ); return s != -1 && possible[ s ] == _min_counts[ s ]; };
+		auto forced = std::find_if( domain.begin(), domain.end(), is_forced );
+		if( forced != domain.end() )
+		{
+			if( std::find_if( forced + 1, domain.end(), is_forced ) != domain.end() )
+			{
+				domain.clear();
+				return;
+			}
+
+			int value = *forced;
+			domain.assign( 1, value );
+			continue;
+		}
+
+		// If a value is already taken by as many variables as allowed, other variables cannot take it.
+		domain.erase( std::remove_if( domain.begin(),
+		                              domain.end(),
+		                              [&]( int value ){ int s = slot( value ); return s != -1 && fixed[ s ] == _max_counts[ s ]; } ),
+		              domain.end() );
+	}
+}
+
+bool GlobalCardinality::optional_is_swap_invariant() const
+{
+	return true;
+}
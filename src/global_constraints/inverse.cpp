@@ -0,0 +1,166 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_constraints/inverse.hpp"
+
+using ghost::Variable;
+using ghost::global_constraints::Inverse;
+
+namespace
+{
+	template<typename T>
+	std::vector<T> inverse_scope( const std::vector<T>& x, const std::vector<T>& y )
+	{
+		std::vector<T> scope( x );
+		scope.insert( scope.end(), y.begin(), y.end() );
+		return scope;
+	}
+}
+
+Inverse::Inverse( const std::vector<int>& x_index, const std::vector<int>& y_index, int offset )
+	: Constraint( inverse_scope( x_index, y_index ) ),
+	  _size( static_cast<int>( x_index.size() ) ),
+	  _offset( offset ),
+	  _values( 2 * x_index.size(), -1 )
+{
+	if( x_index.size() != y_index.size() )
+		throw sizeException( static_cast<int>( x_index.size() ), static_cast<int>( y_index.size() ) );
+}
+
+Inverse::Inverse( const std::vector<Variable>& x, const std::vector<Variable>& y, int offset )
+	: Constraint( inverse_scope( x, y ) ),
+	  _size( static_cast<int>( x.size() ) ),
+	  _offset( offset ),
+	  _values( 2 * x.size(), -1 )
+{
+	if( x.size() != y.size() )
+		throw sizeException( static_cast<int>( x.size() ), static_cast<int>( y.size() ) );
+}
+
+bool Inverse::is_matched( int i, int j ) const
+{
+	return i >= 0 && i < _size && j >= 0 && j < _size && _values[ i ] == j && _values[ _size + j ] == i;
+}
+
+double Inverse::required_error( const std::vector<Variable*>& variables ) const
+{
+	for( int i = 0 ; i < 2 * _size ; ++i )
+		_values[ i ] = variables[ i ]->get_value() - _offset;
+
+	int matched = 0;
+	for( int i = 0 ; i < _size ; ++i )
+		if( is_matched( i, _values[ i ] ) )
+			++matched;
+
+	return static_cast<double>( 2 * ( _size - matched ) );
+}
+
+double Inverse::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	// Pairs (i, j) that may be matched or unmatched by the changes
+	std::vector<std::pair<int, int>> pairs;
+	auto add_pair = [&]( int i, int j )
+	{
+		if( std::find( pairs.begin(), pairs.end(), std::make_pair( i, j ) ) == pairs.end() )
+			pairs.emplace_back( i, j );
+	};
+
+	for( int k = 0 ; k < static_cast<int>( variable_indexes.size() ) ; ++k )
+	{
+		int position = variable_indexes[ k ];
+		if( position < _size )
+		{
+			add_pair( position, _values[ position ] );
+			add_pair( position, candidate_values[ k ] - _offset );
+		}
+		else
+		{
+			add_pair( _values[ position ], position - _size );
+			add_pair( candidate_values[ k ] - _offset, position - _size );
+		}
+	}
+
+	int matched_before = 0;
+	for( const auto& pair : pairs )
+		if( is_matched( pair.first, pair.second ) )
+			++matched_before;
+
+	// Apply the changes, count matched pairs, then revert them
+	std::vector<int> old_values;
+	old_values.reserve( variable_indexes.size() );
+	for( int k = 0 ; k < static_cast<int>( variable_indexes.size() ) ; ++k )
+	{
+		old_values.push_back( _values[ variable_indexes[ k ] ] );
+		_values[ variable_indexes[ k ] ] = candidate_values[ k ] - _offset;
+	}
+
+	int matched_after = 0;
+	for( const auto& pair : pairs )
+		if( is_matched( pair.first, pair.second ) )
+			++matched_after;
+
+	for( int k = static_cast<int>( variable_indexes.size() ) - 1 ; k >= 0 ; --k )
+		_values[ variable_indexes[ k ] ] = old_values[ k ];
+
+	return static_cast<double>( 2 * ( matched_before - matched_after ) );
+}
+
+void Inverse::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	_values[ variable_index ] = new_value - _offset;
+}
+
+// x[i] can take the value j + offset only if y[j] can take the value i + offset, and conversely.
+void Inverse::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	auto contains = [&]( int position, int value ){ return std::find( domains[ position ].begin(), domains[ position ].end(), value ) != domains[ position ].end(); };
+
+	for( int side = 0 ; side < 2 ; ++side )
+	{
+		int first = side == 0 ? 0 : _size;
+		int other = side == 0 ? _size : 0;
+
+		for( int i = 0 ; i < _size ; ++i )
+		{
+			auto& domain = domains[ first + i ];
+			domain.erase( std::remove_if( domain.begin(),
+			                              domain.end(),
+			                              [&]( int value )
+			                              {
+				                              int j = value - _offset;
+				                              return j < 0 || j >= _size || !contains( other + j, i + _offset );
+			                              } ),
+			              domain.end() );
+		}
+	}
+}
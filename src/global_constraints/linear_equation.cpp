@@ -29,6 +29,10 @@
 
 #include <cmath>
 #include <algorithm>
+#include <numeric>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <iostream>
 
 #include "global_constraints/linear_equation.hpp"
@@ -38,20 +42,49 @@ using ghost::global_constraints::LinearEquation;
 LinearEquation::LinearEquation( const std::vector<int>& variables_index, double rhs, const std::vector<double>& coefficients )
 	: Constraint( variables_index ),
 	  _coefficients( coefficients ),
+	  _current_sum( 0.0 ),
+	  _current_integer_sum( 0 ),
 	  rhs( rhs )
-{ }
+{
+	initialize_integer_coefficients();
+}
 
 LinearEquation::LinearEquation( const std::vector<Variable>& variables, double rhs, const std::vector<double>& coefficients )
 	: Constraint( variables ),
 	  _coefficients( coefficients ),
+	  _current_sum( 0.0 ),
+	  _current_integer_sum( 0 ),
 	  rhs( rhs )
-{ }
+{
+	initialize_integer_coefficients();
+}
+
+void LinearEquation::initialize_integer_coefficients()
+{
+	_is_integer = std::all_of( _coefficients.cbegin(),
+	                           _coefficients.cend(),
+	                           []( double coefficient ){ return std::trunc( coefficient ) == coefficient
+	                                                            && std::abs( coefficient ) <= std::numeric_limits<std::int32_t>::max(); } );
+
+	if( _is_integer )
+		std::transform( _coefficients.cbegin(),
+		                _coefficients.cend(),
+		                std::back_inserter( _integer_coefficients ),
+		                []( double coefficient ){ return static_cast<std::int64_t>( coefficient ); } );
+}
 
 double LinearEquation::required_error( const std::vector<Variable*>& variables ) const
 {
-	_current_sum = 0.0;
-	for( size_t i = 0 ; i < variables.size() ; ++i )
-		_current_sum += ( _coefficients[i] * variables[i]->get_value() );
+	_values.resize( variables.size() );
+	std::transform( variables.cbegin(), variables.cend(), _values.begin(), []( auto& v ){ return v->get_value(); } );
+
+	if( _is_integer )
+	{
+		_current_integer_sum = std::transform_reduce( _integer_coefficients.cbegin(), _integer_coefficients.cend(), _values.cbegin(), std::int64_t( 0 ) );
+		_current_sum = static_cast<double>( _current_integer_sum );
+	}
+	else
+		_current_sum = std::transform_reduce( _coefficients.cbegin(), _coefficients.cend(), _values.cbegin(), 0.0 );
 
 	return compute_error( _current_sum );
 }
@@ -60,15 +93,78 @@ double LinearEquation::optional_delta_error( const std::vector<Variable*>& varia
                                              const std::vector<int>& variable_indexes,
                                              const std::vector<int>& candidate_values ) const
 {
+	if( _is_integer )
+	{
+		std::int64_t sum = _current_integer_sum;
+
+		for( size_t i = 0 ; i < variable_indexes.size(); ++i )
+			sum += ( _integer_coefficients[ variable_indexes[i] ] * ( static_cast<std::int64_t>( candidate_values[ i ] ) - _values[ variable_indexes[i] ] ) );
+
+		return compute_error( static_cast<double>( sum ) ) - get_current_error();
+	}
+
 	double sum = _current_sum;
 
 	for( size_t i = 0 ; i < variable_indexes.size(); ++i )
-		sum += ( _coefficients[ variable_indexes[i] ] * ( candidate_values[ i ] - variables[ variable_indexes[i] ]->get_value() ) );
+		sum += ( _coefficients[ variable_indexes[i] ] * ( static_cast<std::int64_t>( candidate_values[ i ] ) - _values[ variable_indexes[i] ] ) );
 	
 	return compute_error( sum ) - get_current_error();
 } 
 
 void LinearEquation::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value ) 
 {
-	_current_sum += _coefficients[ variable_index ] * ( new_value - variables[ variable_index ]->get_value() );
+	if( _is_integer )
+	{
+		_current_integer_sum += _integer_coefficients[ variable_index ] * ( static_cast<std::int64_t>( new_value ) - _values[ variable_index ] );
+		_current_sum = static_cast<double>( _current_integer_sum );
+	}
+	else
+		_current_sum += _coefficients[ variable_index ] * ( static_cast<std::int64_t>( new_value ) - _values[ variable_index ] );
+
+	_values[ variable_index ] = new_value;
+}
+
+void LinearEquation::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	int size = static_cast<int>( domains.size() );
+	std::vector<double> min_terms( size );
+	std::vector<double> max_terms( size );
+	bool changed = true;
+
+	while( changed )
+	{
+		changed = false;
+		double min_sum = 0.0;
+		double max_sum = 0.0;
+
+		for( int i = 0 ; i < size ; ++i )
+		{
+			auto minmax = std::minmax_element( domains[ i ].begin(), domains[ i ].end() );
+			min_terms[ i ] = std::min( _coefficients[ i ] * *minmax.first, _coefficients[ i ] * *minmax.second );
+			max_terms[ i ] = std::max( _coefficients[ i ] * *minmax.first, _coefficients[ i ] * *minmax.second );
+			min_sum += min_terms[ i ];
+			max_sum += max_terms[ i ];
+		}
+
+		// Keep a value if, fixing its variable to it, the bounds of the sum still allow a solution
+		for( int i = 0 ; i < size ; ++i )
+		{
+			auto new_end = std::remove_if( domains[ i ].begin(),
+			                               domains[ i ].end(),
+			                               [&]( int value ){ return !is_satisfiable_within( min_sum - min_terms[ i ] + _coefficients[ i ] * value,
+			                                                                                max_sum - max_terms[ i ] + _coefficients[ i ] * value ); } );
+			if( new_end != domains[ i ].end() )
+			{
+				domains[ i ].erase( new_end, domains[ i ].end() );
+				if( domains[ i ].empty() )
+					return;
+				changed = true;
+			}
+		}
+	}
+}
+
+bool LinearEquation::optional_is_swap_invariant() const
+{
+	return std::adjacent_find( _coefficients.cbegin(), _coefficients.cend(), std::not_equal_to<double>() ) == _coefficients.cend();
 }
@@ -55,3 +55,8 @@ double LinearEquationEq::compute_error( double sum ) const
 {
 	return std::abs( sum - rhs );
 }
+
+bool LinearEquationEq::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return min_sum <= rhs && rhs <= max_sum;
+}
@@ -59,3 +59,8 @@ double LinearEquationG::compute_error( double sum ) const
 		
 	return std::max( 0.0, rhs - sum ) + equals;
 }
+
+bool LinearEquationG::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return max_sum > rhs;
+}
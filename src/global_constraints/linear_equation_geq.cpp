@@ -55,3 +55,8 @@ double LinearEquationGeq::compute_error( double sum ) const
 {
 	return std::max( 0.0, rhs - sum );
 }
+
+bool LinearEquationGeq::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return max_sum >= rhs;
+}
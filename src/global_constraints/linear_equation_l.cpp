@@ -59,3 +59,8 @@ double LinearEquationL::compute_error( double sum ) const
 		
 	return std::max( 0.0, sum - rhs ) + equals;
 }
+
+bool LinearEquationL::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return min_sum < rhs;
+}
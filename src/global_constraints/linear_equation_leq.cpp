@@ -55,3 +55,8 @@ double LinearEquationLeq::compute_error( double sum ) const
 {
 	return std::max( 0.0, sum - rhs );
 }
+
+bool LinearEquationLeq::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return min_sum <= rhs;
+}
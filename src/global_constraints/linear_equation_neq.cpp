@@ -59,3 +59,8 @@ double LinearEquationNeq::compute_error( double sum ) const
 
 	return equals_current;
 }
+
+bool LinearEquationNeq::is_satisfiable_within( double min_sum, double max_sum ) const
+{
+	return min_sum != max_sum || min_sum != rhs;
+}
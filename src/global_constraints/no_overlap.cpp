@@ -0,0 +1,154 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include "global_constraints/no_overlap.hpp"
+
+using ghost::global_constraints::NoOverlap;
+
+NoOverlap::NoOverlap( const std::vector<int>& variables_index, const std::vector<int>& durations )
+	: Constraint( variables_index ),
+	  _durations( durations ),
+	  _max_duration( durations.empty() ? 0 : *std::max_element( durations.begin(), durations.end() ) ),
+	  _starts( variables_index.size() )
+{
+	if( _durations.size() != variables_index.size() )
+		throw sizeException( static_cast<int>( _durations.size() ), static_cast<int>( variables_index.size() ) );
+}
+
+NoOverlap::NoOverlap( const std::vector<Variable>& variables, const std::vector<int>& durations )
+	: Constraint( variables ),
+	  _durations( durations ),
+	  _max_duration( durations.empty() ? 0 : *std::max_element( durations.begin(), durations.end() ) ),
+	  _starts( variables.size() )
+{
+	if( _durations.size() != variables.size() )
+		throw sizeException( static_cast<int>( _durations.size() ), static_cast<int>( variables.size() ) );
+}
+
+template<typename Predicate>
+long long NoOverlap::task_overlap( int task, int start, Predicate is_ignored ) const
+{
+	long long end = static_cast<long long>( start ) + _durations[ task ];
+	long long overlap = 0;
+
+	// Only tasks starting in ]start - _max_duration, end[ can overlap the task.
+	long long window_start = std::max( static_cast<long long>( start ) - _max_duration + 1, static_cast<long long>( std::numeric_limits<int>::min() ) );
+	for( auto it = _tasks.lower_bound( { static_cast<int>( window_start ), std::numeric_limits<int>::min() } ) ; it != _tasks.end() && it->first < end ; ++it )
+		if( it->second != task && !is_ignored( it->second ) )
+			overlap += std::max( 0LL, std::min( end, static_cast<long long>( it->first ) + _durations[ it->second ] ) - std::max( static_cast<long long>( start ), static_cast<long long>( it->first ) ) );
+
+	return overlap;
+}
+
+double NoOverlap::required_error( const std::vector<Variable*>& variables ) const
+{
+	_tasks.clear();
+	for( int task = 0 ; task < static_cast<int>( variables.size() ) ; ++task )
+	{
+		_starts[ task ] = variables[ task ]->get_value();
+		_tasks.emplace( _starts[ task ], task );
+	}
+
+	// Each overlapping pair is counted twice.
+	long long overlap = 0;
+	for( int task = 0 ; task < static_cast<int>( variables.size() ) ; ++task )
+		overlap += task_overlap( task, _starts[ task ], []( int ){ return false; } );
+
+	return static_cast<double>( overlap / 2 );
+}
+
+double NoOverlap::optional_delta_error( const std::vector<Variable*>& variables,
+                                        const std::vector<int>& variable_indexes,
+                                        const std::vector<int>& candidate_values ) const
+{
+	auto is_changed = [&]( int task ){ return std::find( variable_indexes.begin(), variable_indexes.end(), task ) != variable_indexes.end(); };
+
+	long long delta = 0;
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int task = variable_indexes[ i ];
+		delta += task_overlap( task, candidate_values[ i ], is_changed ) - task_overlap( task, _starts[ task ], is_changed );
+
+		// Overlaps between changed tasks
+		for( int j = i + 1 ; j < static_cast<int>( variable_indexes.size() ) ; ++j )
+		{
+			int other = variable_indexes[ j ];
+			auto pair_overlap = [&]( long long start, long long other_start )
+			{
+				return std::max( 0LL, std::min( start + _durations[ task ], other_start + _durations[ other ] ) - std::max( start, other_start ) );
+			};
+
+			delta += pair_overlap( candidate_values[ i ], candidate_values[ j ] ) - pair_overlap( _starts[ task ], _starts[ other ] );
+		}
+	}
+
+	return static_cast<double>( delta );
+}
+
+void NoOverlap::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	_tasks.erase( { _starts[ variable_index ], variable_index } );
+	_starts[ variable_index ] = new_value;
+	_tasks.emplace( new_value, variable_index );
+}
+
+// Start times of other tasks overlapping a task with a fixed start time are removed.
+void NoOverlap::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	for( int task = 0 ; task < static_cast<int>( domains.size() ) ; ++task )
+	{
+		if( domains[ task ].size() != 1 || _durations[ task ] == 0 )
+			continue;
+
+		long long start = domains[ task ][0];
+		long long end = start + _durations[ task ];
+
+		for( int other = 0 ; other < static_cast<int>( domains.size() ) ; ++other )
+			if( other != task )
+			{
+				auto& domain = domains[ other ];
+				domain.erase( std::remove_if( domain.begin(),
+				                              domain.end(),
+				                              [&]( long long other_start ){ return _durations[ other ] > 0 && other_start < end && start < other_start + _durations[ other ]; } ),
+				              domain.end() );
+
+				if( domain.empty() )
+					return;
+			}
+	}
+}
+
+bool NoOverlap::optional_is_swap_invariant() const
+{
+	return std::adjacent_find( _durations.cbegin(), _durations.cend(), std::not_equal_to<int>() ) == _durations.cend();
+}
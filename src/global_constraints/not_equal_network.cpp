@@ -0,0 +1,295 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "global_constraints/not_equal_network.hpp"
+
+using ghost::global_constraints::NotEqualNetwork;
+
+NotEqualNetwork::NotEqualNetwork( const std::vector<int>& variables_index, const std::vector<std::pair<int, int>>& edges )
+	: Constraint( variables_index ),
+	  _value_offset( 0 ),
+	  _counted_variable( -1 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
+{
+	initialize_graph( variables_index, edges );
+}
+
+NotEqualNetwork::NotEqualNetwork( const std::vector<Variable>& variables, const std::vector<std::pair<int, int>>& edges )
+	: Constraint( variables ),
+	  _value_offset( 0 ),
+	  _counted_variable( -1 ),
+	  _is_dense( true ),
+	  _is_initialized( false )
+{
+	std::vector<int> variables_index;
+	variables_index.reserve( variables.size() );
+	for( const auto& variable : variables )
+		variables_index.push_back( variable.get_id() );
+
+	initialize_graph( variables_index, edges );
+}
+
+void NotEqualNetwork::initialize_graph( const std::vector<int>& variables_index, const std::vector<std::pair<int, int>>& edges )
+{
+	int number_variables = static_cast<int>( variables_index.size() );
+
+	std::unordered_map<int, int> position;
+	for( int i = 0 ; i < number_variables ; ++i )
+		position[ variables_index[ i ] ] = i;
+
+	_offsets.assign( number_variables + 1, 0 );
+	for( const auto& edge : edges )
+		if( edge.first != edge.second )
+		{
+			++_offsets[ position.at( edge.first ) + 1 ];
+			++_offsets[ position.at( edge.second ) + 1 ];
+		}
+
+	for( int i = 0 ; i < number_variables ; ++i )
+		_offsets[ i + 1 ] += _offsets[ i ];
+
+	_neighbours.resize( _offsets[ number_variables ] );
+	std::vector<int> next( _offsets.begin(), _offsets.end() - 1 );
+	for( const auto& edge : edges )
+		if( edge.first != edge.second )
+		{
+			int first = position.at( edge.first );
+			int second = position.at( edge.second );
+			_neighbours[ next[ first ]++ ] = second;
+			_neighbours[ next[ second ]++ ] = first;
+		}
+
+	_values.resize( number_variables );
+	_conflicts.resize( number_variables );
+}
+
+int NotEqualNetwork::count_neighbours_with_value( int index, int value ) const
+{
+	int count = 0;
+	for( int n = _offsets[ index ] ; n < _offsets[ index + 1 ] ; ++n )
+		if( _values[ _neighbours[ n ] ] == value )
+			++count;
+
+	return count;
+}
+
+// Like in AllDifferent, counts are sparse if the 64-bit span of domain bounds exceeds 4 times the total domain size.
+void NotEqualNetwork::initialize_value_counts( const std::vector<Variable*>& variables ) const
+{
+	long long min_value = variables[0]->get_domain_min_value();
+	long long max_value = variables[0]->get_domain_max_value();
+	long long total_size = 0;
+	for( auto v : variables )
+	{
+		min_value = std::min( min_value, static_cast<long long>( v->get_domain_min_value() ) );
+		max_value = std::max( max_value, static_cast<long long>( v->get_domain_max_value() ) );
+		total_size += static_cast<long long>( v->get_domain_size() );
+	}
+
+	long long span = max_value - min_value + 1;
+	_is_dense = span <= 4 * total_size;
+	if( _is_dense )
+	{
+		_value_offset = static_cast<int>( min_value );
+		_value_count.resize( static_cast<std::size_t>( span ) );
+	}
+	_is_initialized = true;
+}
+
+void NotEqualNetwork::count_neighbour_values( int index ) const
+{
+	if( _is_dense )
+		for( int n = _offsets[ index ] ; n < _offsets[ index + 1 ] ; ++n )
+			++_value_count[ _values[ _neighbours[ n ] ] - _value_offset ];
+	else
+		for( int n = _offsets[ index ] ; n < _offsets[ index + 1 ] ; ++n )
+			++_sparse_value_count[ _values[ _neighbours[ n ] ] ];
+
+	_counted_variable = index;
+}
+
+int NotEqualNetwork::neighbour_value_count( int value ) const
+{
+	if( !_is_dense )
+	{
+		auto it = _sparse_value_count.find( value );
+		return it == _sparse_value_count.end() ? 0 : it->second;
+	}
+
+	long long index = static_cast<long long>( value ) - _value_offset;
+	return index >= 0 && index < static_cast<long long>( _value_count.size() ) ? _value_count[ index ] : 0;
+}
+
+// Reset counts by a pass over neighbours of the counted variable, rather than over all values.
+void NotEqualNetwork::clear_neighbour_values() const
+{
+	if( _counted_variable == -1 )
+		return;
+
+	if( _is_dense )
+		for( int n = _offsets[ _counted_variable ] ; n < _offsets[ _counted_variable + 1 ] ; ++n )
+			_value_count[ _values[ _neighbours[ n ] ] - _value_offset ] = 0;
+	else
+		_sparse_value_count.clear();
+
+	_counted_variable = -1;
+}
+
+double NotEqualNetwork::required_error( const std::vector<Variable*>& variables ) const
+{
+	if( !_is_initialized )
+		initialize_value_counts( variables );
+
+	clear_neighbour_values();
+
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+		_values[ i ] = variables[ i ]->get_value();
+
+	int conflicts = 0;
+	for( int i = 0 ; i < static_cast<int>( variables.size() ) ; ++i )
+	{
+		_conflicts[ i ] = count_neighbours_with_value( i, _values[ i ] );
+		conflicts += _conflicts[ i ];
+	}
+
+	// Each conflicting edge is counted by both of its endpoints
+	return static_cast<double>( conflicts / 2 );
+}
+
+double NotEqualNetwork::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
+{
+	// Single variable changes are the most frequent: neighbour values are counted once, then reused for each candidate value.
+	if( variable_indexes.size() == 1 )
+	{
+		int index = variable_indexes[0];
+		if( _counted_variable != index )
+		{
+			clear_neighbour_values();
+			count_neighbour_values( index );
+		}
+
+		return static_cast<double>( neighbour_value_count( candidate_values[0] ) - _conflicts[ index ] );
+	}
+
+	// Otherwise, changes are applied one by one on values, then reverted.
+	clear_neighbour_values();
+	int delta = 0;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int index = variable_indexes[ i ];
+		delta += count_neighbours_with_value( index, candidate_values[ i ] ) - count_neighbours_with_value( index, _values[ index ] );
+		_values[ index ] = candidate_values[ i ];
+	}
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+		_values[ variable_indexes[ i ] ] = variables[ variable_indexes[ i ] ]->get_value();
+
+	return static_cast<double>( delta );
+}
+
+void NotEqualNetwork::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	clear_neighbour_values();
+
+	int old_value = _values[ variable_index ];
+	if( old_value == new_value )
+		return;
+
+	for( int n = _offsets[ variable_index ] ; n < _offsets[ variable_index + 1 ] ; ++n )
+	{
+		int neighbour = _neighbours[ n ];
+		if( _values[ neighbour ] == old_value )
+		{
+			--_conflicts[ neighbour ];
+			--_conflicts[ variable_index ];
+		}
+		else if( _values[ neighbour ] == new_value )
+		{
+			++_conflicts[ neighbour ];
+			++_conflicts[ variable_index ];
+		}
+	}
+
+	_values[ variable_index ] = new_value;
+}
+
+void NotEqualNetwork::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	// The value of an assigned variable is removed from domains of its neighbours
+	for( int i = 0 ; i < static_cast<int>( domains.size() ) ; ++i )
+		if( domains[ i ].size() == 1 )
+		{
+			int value = domains[ i ][ 0 ];
+			for( int n = _offsets[ i ] ; n < _offsets[ i + 1 ] ; ++n )
+			{
+				auto& domain = domains[ _neighbours[ n ] ];
+				auto it = std::find( domain.begin(), domain.end(), value );
+				if( it != domain.end() )
+					domain.erase( it );
+			}
+		}
+}
+
+double NotEqualNetwork::optional_variable_error( const std::vector<Variable*>& variables, int index ) const
+{
+	return static_cast<double>( _conflicts[ index ] );
+}
+
+void NotEqualNetwork::optional_variable_error_changes( const std::vector<Variable*>& variables,
+                                                       int index,
+                                                       int new_value,
+                                                       std::vector<std::pair<int, double>>& error_changes ) const
+{
+	int old_value = _values[ index ];
+	if( old_value == new_value )
+		return;
+
+	int change = 0;
+	for( int n = _offsets[ index ] ; n < _offsets[ index + 1 ] ; ++n )
+	{
+		int neighbour = _neighbours[ n ];
+		if( _values[ neighbour ] == old_value )
+		{
+			error_changes.emplace_back( neighbour, -1.0 );
+			--change;
+		}
+		else if( _values[ neighbour ] == new_value )
+		{
+			error_changes.emplace_back( neighbour, 1.0 );
+			++change;
+		}
+	}
+
+	error_changes.emplace_back( index, static_cast<double>( change ) );
+}
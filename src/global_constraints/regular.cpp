@@ -0,0 +1,304 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+
+#include "global_constraints/regular.hpp"
+
+using ghost::global_constraints::Regular;
+
+Regular::Regular( const std::vector<int>& variables_index,
+                  int number_states,
+                  int initial_state,
+                  const std::vector<int>& final_states,
+                  const std::vector<std::tuple<int, int, int>>& transitions )
+	: Constraint( variables_index ),
+	  _length( static_cast<int>( variables_index.size() ) ),
+	  _number_states( number_states ),
+	  _initial_state( initial_state ),
+	  _infinity( static_cast<int>( variables_index.size() ) + 1 )
+{
+	initialize_automaton( number_states, final_states, transitions );
+}
+
+Regular::Regular( const std::vector<Variable>& variables,
+                  int number_states,
+                  int initial_state,
+                  const std::vector<int>& final_states,
+                  const std::vector<std::tuple<int, int, int>>& transitions )
+	: Constraint( variables ),
+	  _length( static_cast<int>( variables.size() ) ),
+	  _number_states( number_states ),
+	  _initial_state( initial_state ),
+	  _infinity( static_cast<int>( variables.size() ) + 1 )
+{
+	initialize_automaton( number_states, final_states, transitions );
+}
+
+void Regular::initialize_automaton( int number_states, const std::vector<int>& final_states, const std::vector<std::tuple<int, int, int>>& transitions )
+{
+	if( _initial_state < 0 || _initial_state >= number_states )
+		throw stateException( "initial state", _initial_state, number_states );
+
+	_is_final.assign( number_states, false );
+	for( int state : final_states )
+	{
+		if( state < 0 || state >= number_states )
+			throw stateException( "final state", state, number_states );
+		_is_final[ state ] = true;
+	}
+
+	for( const auto& transition : transitions )
+	{
+		if( std::get<0>( transition ) < 0 || std::get<0>( transition ) >= number_states )
+			throw stateException( "transition source state", std::get<0>( transition ), number_states );
+		if( std::get<2>( transition ) < 0 || std::get<2>( transition ) >= number_states )
+			throw stateException( "transition target state", std::get<2>( transition ), number_states );
+	}
+
+	for( const auto& transition : transitions )
+		_symbols.emplace( std::get<1>( transition ), static_cast<int>( _symbols.size() ) );
+
+	_number_symbols = static_cast<int>( _symbols.size() );
+	_transitions.assign( number_states * _number_symbols, -1 );
+	for( const auto& transition : transitions )
+	{
+		int& next_state = _transitions[ std::get<0>( transition ) * _number_symbols + _symbols.at( std::get<1>( transition ) ) ];
+		if( next_state != -1 && next_state != std::get<2>( transition ) )
+			throw nonDeterministicException( std::get<0>( transition ), std::get<1>( transition ) );
+		next_state = std::get<2>( transition );
+	}
+
+	_word.resize( _length );
+	_forward.resize( ( _length + 1 ) * number_states );
+	_backward.resize( ( _length + 1 ) * number_states );
+	_best_next.resize( _length * number_states );
+}
+
+int Regular::symbol( int value ) const
+{
+	auto it = _symbols.find( value );
+	return it == _symbols.end() ? -1 : it->second;
+}
+
+// next[ q' ] is the minimal cost of previous[ q ], plus 1 if the symbol of the transition q -> q' is not read_symbol.
+void Regular::compute_forward_layer( const int* previous, int read_symbol, int* next ) const
+{
+	std::fill( next, next + _number_states, _infinity );
+
+	for( int state = 0 ; state < _number_states ; ++state )
+		if( previous[ state ] < _infinity )
+			for( int s = 0 ; s < _number_symbols ; ++s )
+			{
+				int next_state = _transitions[ state * _number_symbols + s ];
+				if( next_state >= 0 )
+					next[ next_state ] = std::min( next[ next_state ], std::min( previous[ state ] + ( s == read_symbol ? 0 : 1 ), _infinity ) );
+			}
+}
+
+bool Regular::compute_backward_layer( int position ) const
+{
+	const int* next = &_backward[ ( position + 1 ) * _number_states ];
+	int* best_next = &_best_next[ position * _number_states ];
+	int* layer = &_backward[ position * _number_states ];
+	bool changed = false;
+
+	for( int state = 0 ; state < _number_states ; ++state )
+	{
+		int best = _infinity;
+		for( int s = 0 ; s < _number_symbols ; ++s )
+		{
+			int next_state = _transitions[ state * _number_symbols + s ];
+			if( next_state >= 0 )
+				best = std::min( best, next[ next_state ] );
+		}
+		best_next[ state ] = best;
+
+		int cost = std::min( best + 1, _infinity );
+		if( _word[ position ] >= 0 )
+		{
+			int next_state = _transitions[ state * _number_symbols + _word[ position ] ];
+			if( next_state >= 0 )
+				cost = std::min( cost, next[ next_state ] );
+		}
+
+		if( layer[ state ] != cost )
+		{
+			layer[ state ] = cost;
+			changed = true;
+		}
+	}
+
+	return changed;
+}
+
+// Error of the sequence where the symbol at position is replaced by read_symbol, in O(states).
+int Regular::error_through( int position, int read_symbol ) const
+{
+	const int* previous = &_forward[ position * _number_states ];
+	const int* next = &_backward[ ( position + 1 ) * _number_states ];
+	const int* best_next = &_best_next[ position * _number_states ];
+	int error = _infinity;
+
+	for( int state = 0 ; state < _number_states ; ++state )
+		if( previous[ state ] < _infinity )
+		{
+			int cost = best_next[ state ] + 1;
+			if( read_symbol >= 0 )
+			{
+				int next_state = _transitions[ state * _number_symbols + read_symbol ];
+				if( next_state >= 0 )
+					cost = std::min( cost, next[ next_state ] );
+			}
+			error = std::min( error, previous[ state ] + cost );
+		}
+
+	return error;
+}
+
+double Regular::required_error( const std::vector<Variable*>& variables ) const
+{
+	for( int position = 0 ; position < _length ; ++position )
+		_word[ position ] = symbol( variables[ position ]->get_value() );
+
+	std::fill( _forward.begin(), _forward.begin() + _number_states, _infinity );
+	_forward[ _initial_state ] = 0;
+	for( int position = 0 ; position < _length ; ++position )
+		compute_forward_layer( &_forward[ position * _number_states ], _word[ position ], &_forward[ ( position + 1 ) * _number_states ] );
+
+	for( int state = 0 ; state < _number_states ; ++state )
+		_backward[ _length * _number_states + state ] = _is_final[ state ] ? 0 : _infinity;
+	for( int position = _length - 1 ; position >= 0 ; --position )
+		compute_backward_layer( position );
+
+	return static_cast<double>( _backward[ _initial_state ] );
+}
+
+double Regular::optional_delta_error( const std::vector<Variable*>& variables,
+                                      const std::vector<int>& variable_indexes,
+                                      const std::vector<int>& candidate_values ) const
+{
+	int current_error = _backward[ _initial_state ];
+
+	if( variable_indexes.size() == 1 )
+		return static_cast<double>( error_through( variable_indexes[0], symbol( candidate_values[0] ) ) - current_error );
+
+	// Otherwise, forward layers are recomputed from the first to the last changed position.
+	std::vector<std::pair<int, int>> changes;
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+		changes.emplace_back( variable_indexes[ i ], symbol( candidate_values[ i ] ) );
+	std::sort( changes.begin(), changes.end() );
+
+	std::vector<int> layer( _forward.begin() + changes.front().first * _number_states, _forward.begin() + ( changes.front().first + 1 ) * _number_states );
+	std::vector<int> next( _number_states );
+	auto change = changes.begin();
+
+	for( int position = changes.front().first ; position <= changes.back().first ; ++position )
+	{
+		int read_symbol = _word[ position ];
+		if( change != changes.end() && change->first == position )
+			read_symbol = ( change++ )->second;
+
+		compute_forward_layer( layer.data(), read_symbol, next.data() );
+		layer.swap( next );
+	}
+
+	const int* backward = &_backward[ ( changes.back().first + 1 ) * _number_states ];
+	int error = _infinity;
+	for( int state = 0 ; state < _number_states ; ++state )
+		error = std::min( error, layer[ state ] + backward[ state ] );
+
+	return static_cast<double>( error - current_error );
+}
+
+void Regular::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	_word[ variable_index ] = symbol( new_value );
+
+	std::vector<int> next( _number_states );
+	for( int position = variable_index ; position < _length ; ++position )
+	{
+		compute_forward_layer( &_forward[ position * _number_states ], _word[ position ], next.data() );
+		auto layer = _forward.begin() + ( position + 1 ) * _number_states;
+		if( std::equal( next.begin(), next.end(), layer ) )
+			break;
+		std::copy( next.begin(), next.end(), layer );
+	}
+
+	for( int position = variable_index ; position >= 0 ; --position )
+		if( !compute_backward_layer( position ) )
+			break;
+}
+
+// Keep values labelling a transition between a state reachable from the initial state and a state reaching a final state.
+void Regular::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	std::vector<bool> reachable( ( _length + 1 ) * _number_states, false );
+	reachable[ _initial_state ] = true;
+	for( int position = 0 ; position < _length ; ++position )
+		for( int state = 0 ; state < _number_states ; ++state )
+			if( reachable[ position * _number_states + state ] )
+				for( int value : domains[ position ] )
+				{
+					int s = symbol( value );
+					if( s >= 0 && _transitions[ state * _number_symbols + s ] >= 0 )
+						reachable[ ( position + 1 ) * _number_states + _transitions[ state * _number_symbols + s ] ] = true;
+				}
+
+	std::vector<bool> coreachable( ( _length + 1 ) * _number_states, false );
+	for( int state = 0 ; state < _number_states ; ++state )
+		coreachable[ _length * _number_states + state ] = _is_final[ state ];
+
+	for( int position = _length - 1 ; position >= 0 ; --position )
+	{
+		auto supported = [&]( int state, int value )
+		{
+			int s = symbol( value );
+			return reachable[ position * _number_states + state ]
+				&& s >= 0
+				&& _transitions[ state * _number_symbols + s ] >= 0
+				&& coreachable[ ( position + 1 ) * _number_states + _transitions[ state * _number_symbols + s ] ];
+		};
+
+		for( int state = 0 ; state < _number_states ; ++state )
+			coreachable[ position * _number_states + state ] = std::any_of( domains[ position ].begin(), domains[ position ].end(), [&]( int value ){ return supported( state, value ); } );
+
+		auto& domain = domains[ position ];
+		domain.erase( std::remove_if( domain.begin(),
+		                              domain.end(),
+		                              [&]( int value )
+		                              {
+			                              for( int state = 0 ; state < _number_states ; ++state )
+				                              if( supported( state, value ) )
+					                              return false;
+			                              return true;
+		                              } ),
+		              domain.end() );
+	}
+}
@@ -0,0 +1,223 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "global_constraints/table.hpp"
+
+using ghost::global_constraints::Table;
+
+Table::Table( const std::vector<int>& variables_index, const std::vector<std::vector<int>>& tuples, bool forbidden )
+	: Constraint( variables_index ),
+	  _arity( static_cast<int>( variables_index.size() ) ),
+	  _forbidden( forbidden ),
+	  _current_hash( 0 )
+{
+	initialize_tuples( tuples );
+}
+
+Table::Table( const std::vector<Variable>& variables, const std::vector<std::vector<int>>& tuples, bool forbidden )
+	: Constraint( variables ),
+	  _arity( static_cast<int>( variables.size() ) ),
+	  _forbidden( forbidden ),
+	  _current_hash( 0 )
+{
+	initialize_tuples( tuples );
+}
+
+// Zobrist key of a value at a given position, computed on the fly with a splitmix64 finalizer.
+std::uint64_t Table::key( int position, int value )
+{
+	std::uint64_t x = ( static_cast<std::uint64_t>( static_cast<std::uint32_t>( position ) ) << 32 ) | static_cast<std::uint32_t>( value );
+	x += 0x9e3779b97f4a7c15ULL;
+	x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+	return x ^ ( x >> 31 );
+}
+
+void Table::initialize_tuples( const std::vector<std::vector<int>>& tuples )
+{
+	for( int t = 0 ; t < static_cast<int>( tuples.size() ) ; ++t )
+		if( static_cast<int>( tuples[ t ].size() ) != _arity )
+			throw tupleSizeException( t, static_cast<int>( tuples[ t ].size() ), _arity );
+
+	// Duplicated tuples are removed, filtering forbidden tuples relies on it.
+	std::vector<std::vector<int>> unique_tuples( tuples );
+	std::sort( unique_tuples.begin(), unique_tuples.end() );
+	unique_tuples.erase( std::unique( unique_tuples.begin(), unique_tuples.end() ), unique_tuples.end() );
+
+	_tuples.reserve( unique_tuples.size() * _arity );
+	_next_tuple.reserve( unique_tuples.size() );
+	_first_tuple.reserve( unique_tuples.size() );
+
+	for( int t = 0 ; t < static_cast<int>( unique_tuples.size() ) ; ++t )
+	{
+		std::uint64_t hash = 0;
+		for( int i = 0 ; i < _arity ; ++i )
+		{
+			_tuples.push_back( unique_tuples[ t ][ i ] );
+			hash ^= key( i, unique_tuples[ t ][ i ] );
+		}
+
+		auto inserted = _first_tuple.emplace( hash, t );
+		if( inserted.second )
+			_next_tuple.push_back( -1 );
+		else
+		{
+			_next_tuple.push_back( inserted.first->second );
+			inserted.first->second = t;
+		}
+	}
+}
+
+bool Table::contains( std::uint64_t hash, const std::vector<int>& values ) const
+{
+	auto it = _first_tuple.find( hash );
+	if( it == _first_tuple.end() )
+		return false;
+
+	for( int t = it->second ; t != -1 ; t = _next_tuple[ t ] )
+		if( std::equal( values.begin(), values.end(), _tuples.begin() + t * _arity ) )
+			return true;
+
+	return false;
+}
+
+double Table::error_for( bool is_in_table ) const
+{
+	return is_in_table == _forbidden ? 1.0 : 0.0;
+}
+
+double Table::required_error( const std::vector<Variable*>& variables ) const
+{
+	_values.resize( _arity );
+	_current_hash = 0;
+
+	for( int i = 0 ; i < _arity ; ++i )
+	{
+		_values[ i ] = variables[ i ]->get_value();
+		_current_hash ^= key( i, _values[ i ] );
+	}
+
+	return error_for( contains( _current_hash, _values ) );
+}
+
+// Candidate values are temporarily written into _values to check the candidate tuple, then reverted.
+double Table::optional_delta_error( const std::vector<Variable*>& variables, const std::vector<int>& variable_indexes, const std::vector<int>& candidate_values ) const
+{
+	std::uint64_t hash = _current_hash;
+
+	for( int i = 0 ; i < static_cast<int>( variable_indexes.size() ) ; ++i )
+	{
+		int index = variable_indexes[ i ];
+		hash ^= key( index, _values[ index ] ) ^ key( index, candidate_values[ i ] );
+		_values[ index ] = candidate_values[ i ];
+	}
+
+	double new_error = error_for( contains( hash, _values ) );
+
+	for( int i = static_cast<int>( variable_indexes.size() ) - 1 ; i >= 0 ; --i )
+		_values[ variable_indexes[ i ] ] = variables[ variable_indexes[ i ] ]->get_value();
+
+	return new_error - get_current_error();
+}
+
+void Table::conditional_update_data_structures( const std::vector<Variable*>& variables, int variable_index, int new_value )
+{
+	_current_hash ^= key( variable_index, _values[ variable_index ] ) ^ key( variable_index, new_value );
+	_values[ variable_index ] = new_value;
+}
+
+// Simple Tabular Reduction: a single pass over tuples keeps the ones valid regarding current domains,
+// recording which values appear in them.
+void Table::optional_filter_domains( const std::vector<Variable*>& variables, std::vector<std::vector<int>>& domains ) const
+{
+	std::vector<int> offsets( _arity );
+	std::vector<std::vector<char>> in_domain( _arity );
+	std::vector<std::vector<int>> occurrences( _arity );
+
+	for( int i = 0 ; i < _arity ; ++i )
+	{
+		if( domains[ i ].empty() )
+			return;
+
+		auto minmax = std::minmax_element( domains[ i ].begin(), domains[ i ].end() );
+		offsets[ i ] = *minmax.first;
+		in_domain[ i ].resize( *minmax.second - *minmax.first + 1, 0 );
+		occurrences[ i ].resize( *minmax.second - *minmax.first + 1, 0 );
+		for( int value : domains[ i ] )
+			in_domain[ i ][ value - offsets[ i ] ] = 1;
+	}
+
+	auto is_valid = [&]( int t )
+	{
+		for( int i = 0 ; i < _arity ; ++i )
+		{
+			int value = _tuples[ t * _arity + i ] - offsets[ i ];
+			if( value < 0 || value >= static_cast<int>( in_domain[ i ].size() ) || !in_domain[ i ][ value ] )
+				return false;
+		}
+		return true;
+	};
+
+	int number_tuples = static_cast<int>( _next_tuple.size() );
+	for( int t = 0 ; t < number_tuples ; ++t )
+		if( is_valid( t ) )
+			for( int i = 0 ; i < _arity ; ++i )
+				++occurrences[ i ][ _tuples[ t * _arity + i ] - offsets[ i ] ];
+
+	// With forbidden tuples, a value has no support iff all combinations of values of other variables are forbidden.
+	// The number of these combinations is computed before domains get filtered.
+	std::vector<double> combinations( _arity, 1.0 );
+	if( _forbidden )
+		for( int i = 0 ; i < _arity ; ++i )
+			for( int j = 0 ; j < _arity ; ++j )
+				if( j != i )
+					combinations[ i ] *= static_cast<double>( domains[ j ].size() );
+
+	for( int i = 0 ; i < _arity ; ++i )
+	{
+		if( _forbidden )
+		{
+			if( combinations[ i ] > number_tuples )
+				continue;
+
+			domains[ i ].erase( std::remove_if( domains[ i ].begin(),
+			                                    domains[ i ].end(),
+			                                    [&]( int value ){ return occurrences[ i ][ value - offsets[ i ] ] == static_cast<int>( combinations[ i ] ); } ),
+			                    domains[ i ].end() );
+		}
+		else
+			domains[ i ].erase( std::remove_if( domains[ i ].begin(),
+			                                    domains[ i ].end(),
+			                                    [&]( int value ){ return occurrences[ i ][ value - offsets[ i ] ] == 0; } ),
+			                    domains[ i ].end() );
+	}
+}
@@ -27,6 +27,8 @@
  * along with GHOST. If not, see http://www.gnu.org/licenses/.
  */
 
+#include <thread>
+
 #include "objective.hpp"
 
 using ghost::Objective;
@@ -35,6 +37,8 @@ Objective::Objective( const std::vector<int>& variables_index, bool is_maximizat
 	: _variables_index( variables_index ),
 	  _is_optimization( true ),
 	  _is_maximization( is_maximization ),
+	  _is_optional_delta_cost_defined( true ),
+	  _heuristic_value_threads( 1 ),
 	  _name( name )
 { }
 
@@ -42,6 +46,8 @@ Objective::Objective( const std::vector<Variable>& variables, bool is_maximizati
 	: _variables_index( std::vector<int>( variables.size() ) ),
 	  _is_optimization( true ),
 	  _is_maximization( is_maximization ),
+	  _is_optional_delta_cost_defined( true ),
+	  _heuristic_value_threads( 1 ),
 	  _name( name )
 {
 	std::transform( variables.begin(),
@@ -63,49 +69,157 @@ double Objective::cost() const
 	return value;
 }
 
+double Objective::delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const
+{
+	std::vector<int> indexes;
+	std::vector<int> values;
+	for( int i = 0 ; i < static_cast<int>( variables_index.size() ) ; ++i )
+	{
+		auto it = _variables_position.find( variables_index[i] );
+		if( it != _variables_position.end() )
+		{
+			indexes.push_back( it->second );
+			values.push_back( candidate_values[i] );
+		}
+	}
+
+	if( indexes.empty() )
+		return 0.0;
+
+	double value = optional_delta_cost( _variables, indexes, values );
+
+	if( std::isnan( value ) )
+		throw nanException( _variables );
+
+	if( _is_maximization )
+		value = -value;
+
+	return value;
+}
+
+double Objective::simulate_delta_cost( const std::vector<int>& variables_index, const std::vector<int>& candidate_values ) const
+{
+	if( _is_optional_delta_cost_defined ) [[likely]]
+		return delta_cost( variables_index, candidate_values );
+
+	std::vector<int> backup_values;
+	for( int i = 0 ; i < static_cast<int>( variables_index.size() ) ; ++i )
+	{
+		auto it = _variables_position.find( variables_index[i] );
+		backup_values.push_back( it == _variables_position.end() ? 0 : _variables[ it->second ]->get_value() );
+		if( it != _variables_position.end() )
+			_variables[ it->second ]->set_value( candidate_values[i] );
+	}
+
+	double candidate_cost = cost();
+
+	for( int i = static_cast<int>( variables_index.size() ) - 1 ; i >= 0 ; --i )
+	{
+		auto it = _variables_position.find( variables_index[i] );
+		if( it != _variables_position.end() )
+			_variables[ it->second ]->set_value( backup_values[i] );
+	}
+
+	// The current cost is computed last, so that data structures initialized in required_cost match the current assignment.
+	return candidate_cost - cost();
+}
+
 void Objective::conditional_update_data_structures( const std::vector<Variable*>& variables, int index, int new_value )
 { }
 
+double Objective::optional_delta_cost( const std::vector<Variable*>& variables, const std::vector<int>& indexes, const std::vector<int>& candidate_values ) const
+{
+	_is_optional_delta_cost_defined = false;
+	throw deltaCostNotDefinedException();
+}
+
+std::vector<double> Objective::candidate_costs( const std::vector<Variable*>& variables, int variable_index, const std::vector<int>& possible_values ) const
+{
+	std::vector<double> costs( possible_values.size() );
+
+	if( _is_optional_delta_cost_defined )
+		try
+		{
+			std::vector<int> indexes{ variable_index };
+			std::vector<int> values{ 0 };
+			for( int i = 0 ; i < static_cast<int>( possible_values.size() ) ; ++i )
+			{
+				values[0] = possible_values[ i ];
+				costs[ i ] = optional_delta_cost( variables, indexes, values );
+			}
+
+			return costs;
+		}
+		catch( const deltaCostNotDefinedException& e ) { }
+
+	// Evaluate values from first to last, with required_cost on a local copy of the changed variable.
+	// Other variables are only read, so they are shared between threads.
+	auto evaluate = [&]( int first, int last )
+	{
+		Variable copy( *variables[ variable_index ] );
+		std::vector<Variable*> pointers( variables );
+		pointers[ variable_index ] = &copy;
+
+		for( int i = first ; i < last ; ++i )
+		{
+			copy.set_value( possible_values[ i ] );
+			costs[ i ] = required_cost( pointers );
+		}
+	};
+
+	int number_values = static_cast<int>( possible_values.size() );
+	int number_threads = std::min( _heuristic_value_threads, number_values );
+
+	if( number_threads <= 1 )
+		evaluate( 0, number_values );
+	else
+	{
+		std::vector<std::thread> threads;
+		int chunk = ( number_values + number_threads - 1 ) / number_threads;
+		for( int first = chunk ; first < number_values ; first += chunk )
+			threads.emplace_back( evaluate, first, std::min( first + chunk, number_values ) );
+
+		evaluate( 0, std::min( chunk, number_values ) );
+
+		for( auto& thread : threads )
+			thread.join();
+	}
+
+	return costs;
+}
+
 int Objective::expert_heuristic_value( const std::vector<Variable*>& variables,
                                        int variable_index,
                                        const std::vector<int>& possible_values,
                                        randutils::mt19937_rng& rng ) const
 {
-	double min_cost = std::numeric_limits<double>::max();
-	double simulated_cost;
+	if( possible_values.empty() )
+		return variables[ variable_index ]->get_value();
+
+	std::vector<double> costs = candidate_costs( variables, variable_index, possible_values );
 
-	auto var = variables[ variable_index ];
-	int backup = var->get_value();
+	double min_cost = std::numeric_limits<double>::max();
 	std::vector<int> best_values;
 
-	for( auto v : possible_values )
+	for( int i = 0 ; i < static_cast<int>( possible_values.size() ) ; ++i )
 	{
-		var->set_value( v );
-		simulated_cost = required_cost( variables );
-
-		if( _is_maximization )
-			simulated_cost = -simulated_cost;
+		double simulated_cost = _is_maximization ? -costs[ i ] : costs[ i ];
 
 		if( min_cost > simulated_cost )
 		{
 			min_cost = simulated_cost;
 			best_values.clear();
-			best_values.push_back( v );
+			best_values.push_back( possible_values[ i ] );
 		}
 		else
 			if( min_cost == simulated_cost )
-				best_values.push_back( v );
+				best_values.push_back( possible_values[ i ] );
 	}
 
-	var->set_value( backup );
-
 	if( !best_values.empty() )
 		return rng.pick( best_values );
 	else
-		if( !possible_values.empty() )
-			return rng.pick( possible_values );
-		else
-			return backup;			
+		return rng.pick( possible_values );
 }
 
 int Objective::expert_heuristic_value_permutation( const std::vector<Variable*>& variables,
@@ -116,6 +230,25 @@ int Objective::expert_heuristic_value_permutation( const std::vector<Variable*>&
 	return rng.pick( bad_variables );
 }
 
+std::vector<int> Objective::critical_variables() const
+{
+	std::vector<int> critical = expert_critical_variables( _variables );
+	for( auto& index : critical )
+		index = _variables_index[ index ];
+
+	return critical;
+}
+
+std::vector<int> Objective::expert_critical_variables( const std::vector<Variable*>& variables ) const
+{
+	return std::vector<int>();
+}
+
+bool Objective::optional_is_separable() const
+{
+	return false;
+}
+
 double Objective::expert_postprocess( const std::vector<Variable*>& variables,
                                       double best_cost ) const
 {
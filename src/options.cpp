@@ -38,6 +38,7 @@ Options::Options()
 	  resume_search( false ),
 	  parallel_runs( false ),
 		enable_optimization_guidance( true ),
+	  preprocessing( false ),
 	  number_threads( std::max( 2, static_cast<int>( std::thread::hardware_concurrency() ) / 2 ) ), // std::thread::hardware_concurrency() returns 0 if it is not able to detect the number of threads
 	  print( std::make_shared<Print>() ),
 	  tabu_time_local_min( -1 ),
@@ -46,7 +47,11 @@ Options::Options()
 	  reset_threshold( -1 ),
 	  restart_threshold( -1 ),
 	  number_variables_to_reset( -1 ),
-	  number_start_samplings( -1 )
+	  number_start_samplings( -1 ),
+	  node_limit( 0 ),
+	  cancel_search( nullptr ),
+	  seed( -1 ),
+	  trajectory_file( "ghost_trajectory.bin" )
 { }
 
 Options::Options( const Options& other )
@@ -54,6 +59,7 @@ Options::Options( const Options& other )
 	  resume_search( other.resume_search ),
 	  parallel_runs( other.parallel_runs ),
 		enable_optimization_guidance( other.enable_optimization_guidance ),
+	  preprocessing( other.preprocessing ),
 	  number_threads( other.number_threads ),
 	  print( other.print ),
 	  tabu_time_local_min( other.tabu_time_local_min ),
@@ -62,7 +68,11 @@ Options::Options( const Options& other )
 	  reset_threshold( other.reset_threshold ),
 	  restart_threshold( other.restart_threshold ),
 	  number_variables_to_reset( other.number_variables_to_reset ),
-	  number_start_samplings( other.number_start_samplings )
+	  number_start_samplings( other.number_start_samplings ),
+	  node_limit( other.node_limit ),
+	  cancel_search( other.cancel_search ),
+	  seed( other.seed ),
+	  trajectory_file( other.trajectory_file )
 { }
 
 Options::Options( Options&& other )
@@ -70,6 +80,7 @@ Options::Options( Options&& other )
 	  resume_search( other.resume_search ),
 	  parallel_runs( other.parallel_runs ),
 		enable_optimization_guidance( other.enable_optimization_guidance ),
+	  preprocessing( other.preprocessing ),
 	  number_threads( other.number_threads ),
 	  print( std::move( other.print ) ),
 	  tabu_time_local_min( other.tabu_time_local_min ),
@@ -78,7 +89,11 @@ Options::Options( Options&& other )
 	  reset_threshold( other.reset_threshold ),
 	  restart_threshold( other.restart_threshold ),
 	  number_variables_to_reset( other.number_variables_to_reset ),
-	  number_start_samplings( other.number_start_samplings )
+	  number_start_samplings( other.number_start_samplings ),
+	  node_limit( other.node_limit ),
+	  cancel_search( std::move( other.cancel_search ) ),
+	  seed( other.seed ),
+	  trajectory_file( std::move( other.trajectory_file ) )
 {	}
 
 Options& Options::operator=( Options other )
@@ -89,6 +104,7 @@ Options& Options::operator=( Options other )
 		resume_search = other.resume_search;
 		parallel_runs = other.parallel_runs;
 		enable_optimization_guidance = other.enable_optimization_guidance;
+		preprocessing = other.preprocessing;
 		number_threads = other.number_threads;
 		std::swap( print, other.print );
 		tabu_time_local_min = other.tabu_time_local_min;
@@ -98,6 +114,10 @@ Options& Options::operator=( Options other )
 		restart_threshold = other.restart_threshold;
 		number_variables_to_reset = other.number_variables_to_reset;
 		number_start_samplings = other.number_start_samplings;
+		node_limit = other.node_limit;
+		std::swap( cancel_search, other.cancel_search );
+		seed = other.seed;
+		std::swap( trajectory_file, other.trajectory_file );
 	}
 
 	return *this;
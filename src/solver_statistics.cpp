@@ -0,0 +1,221 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "solver_statistics.hpp"
+
+using ghost::SolverStatistics;
+using ghost::SearchUnitStatistics;
+
+namespace
+{
+	// JSON has no representations for infinity and NaN.
+	std::string json_number( double number )
+	{
+		if( !std::isfinite( number ) )
+			return "null";
+
+		std::ostringstream stream;
+		stream << std::setprecision( std::numeric_limits<double>::digits10 ) << number;
+		return stream.str();
+	}
+
+	std::string json_string( const std::string& text )
+	{
+		std::ostringstream stream;
+		stream << "\"";
+		for( char c : text )
+		{
+			if( c == '"' || c == '\\' )
+				stream << '\\' << c;
+			else
+				if( static_cast<unsigned char>( c ) < 0x20 )
+					stream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << static_cast<int>( c ) << std::dec;
+				else
+					stream << c;
+		}
+		stream << "\"";
+		return stream.str();
+	}
+
+	// Heuristic names contain spaces, never commas nor quotes; quote them anyway to be safe.
+	std::string csv_string( const std::string& text )
+	{
+		std::string quoted = "\"";
+		for( char c : text )
+		{
+			if( c == '"' )
+				quoted += '"';
+			quoted += c;
+		}
+		quoted += "\"";
+		return quoted;
+	}
+
+	std::string csv_number( double number )
+	{
+		std::ostringstream stream;
+		stream << std::setprecision( std::numeric_limits<double>::digits10 ) << number;
+		return stream.str();
+	}
+
+	std::string unit_to_json( const SearchUnitStatistics& unit )
+	{
+		std::ostringstream stream;
+		stream << "{\"search_iterations\": " << unit.search_iterations
+		       << ", \"local_moves\": " << unit.local_moves
+		       << ", \"plateau_moves\": " << unit.plateau_moves
+		       << ", \"plateau_force_trying_another_variable\": " << unit.plateau_force_trying_another_variable
+		       << ", \"local_minimum\": " << unit.local_minimum
+		       << ", \"resets\": " << unit.resets
+		       << ", \"restarts\": " << unit.restarts
+		       << ", \"satisfaction_error\": " << json_number( unit.satisfaction_error )
+		       << ", \"optimization_cost\": " << json_number( unit.optimization_cost ) << "}";
+		return stream.str();
+	}
+}
+
+std::string SolverStatistics::to_json() const
+{
+	std::ostringstream stream;
+	stream << std::boolalpha
+	       << "{\n"
+	       << "  \"search\": " << json_string( search ) << ",\n"
+	       << "  \"solution_found\": " << solution_found << ",\n"
+	       << "  \"is_optimization\": " << is_optimization << ",\n"
+	       << "  \"parallel_runs\": " << parallel_runs << ",\n"
+	       << "  \"number_threads\": " << number_threads << ",\n"
+	       << "  \"winning_thread\": " << winning_thread << ",\n"
+	       << "  \"variable_heuristic\": " << json_string( variable_heuristic ) << ",\n"
+	       << "  \"variable_candidates_heuristic\": " << json_string( variable_candidates_heuristic ) << ",\n"
+	       << "  \"value_heuristic\": " << json_string( value_heuristic ) << ",\n"
+	       << "  \"error_projection_algorithm\": " << json_string( error_projection_algorithm ) << ",\n"
+	       << "  \"satisfaction_error\": " << json_number( satisfaction_error ) << ",\n"
+	       << "  \"optimization_cost\": " << json_number( optimization_cost ) << ",\n"
+	       << "  \"cost_before_postprocess\": " << json_number( cost_before_postprocess ) << ",\n"
+	       << "  \"search_time_us\": " << json_number( search_time ) << ",\n"
+	       << "  \"postprocess_time_us\": " << json_number( postprocess_time ) << ",\n"
+	       << "  \"wall_clock_time_us\": " << json_number( wall_clock_time ) << ",\n"
+	       << "  \"moves_per_second\": " << json_number( moves_per_second ) << ",\n"
+	       << "  \"total_moves_per_second\": " << json_number( total_moves_per_second ) << ",\n"
+	       << "  \"nodes\": " << nodes << ",\n"
+	       << "  \"fails\": " << fails << ",\n"
+	       << "  \"propagations\": " << propagations << ",\n"
+	       << "  \"number_solutions\": " << json_number( number_solutions ) << ",\n"
+	       << "  \"interrupted\": " << interrupted << ",\n"
+	       << "  \"winning_unit\": " << unit_to_json( winning_unit ) << ",\n"
+	       << "  \"total\": " << unit_to_json( total ) << ",\n"
+	       << "  \"units\": [";
+
+	for( int i = 0 ; i < static_cast<int>( units.size() ) ; ++i )
+		stream << ( i == 0 ? "\n    " : ",\n    " ) << unit_to_json( units[i] );
+
+	stream << ( units.empty() ? "]\n" : "\n  ]\n" ) << "}";
+	return stream.str();
+}
+
+std::string SolverStatistics::csv_header()
+{
+	return "search,solution_found,is_optimization,parallel_runs,number_threads,winning_thread,"
+		"variable_heuristic,variable_candidates_heuristic,value_heuristic,error_projection_algorithm,"
+		"satisfaction_error,optimization_cost,cost_before_postprocess,"
+		"search_time_us,postprocess_time_us,wall_clock_time_us,moves_per_second,total_moves_per_second,"
+		"search_iterations,local_moves,plateau_moves,local_minimum,resets,restarts,"
+		"total_search_iterations,total_local_moves,total_plateau_moves,total_local_minimum,total_resets,total_restarts,"
+		"nodes,fails,propagations,number_solutions,interrupted";
+}
+
+std::string SolverStatistics::to_csv() const
+{
+	std::ostringstream stream;
+	stream << search << ","
+	       << solution_found << ","
+	       << is_optimization << ","
+	       << parallel_runs << ","
+	       << number_threads << ","
+	       << winning_thread << ","
+	       << csv_string( variable_heuristic ) << ","
+	       << csv_string( variable_candidates_heuristic ) << ","
+	       << csv_string( value_heuristic ) << ","
+	       << csv_string( error_projection_algorithm ) << ","
+	       << csv_number( satisfaction_error ) << ","
+	       << csv_number( optimization_cost ) << ","
+	       << csv_number( cost_before_postprocess ) << ","
+	       << csv_number( search_time ) << ","
+	       << csv_number( postprocess_time ) << ","
+	       << csv_number( wall_clock_time ) << ","
+	       << csv_number( moves_per_second ) << ","
+	       << csv_number( total_moves_per_second ) << ","
+	       << winning_unit.search_iterations << ","
+	       << winning_unit.local_moves << ","
+	       << winning_unit.plateau_moves << ","
+	       << winning_unit.local_minimum << ","
+	       << winning_unit.resets << ","
+	       << winning_unit.restarts << ","
+	       << total.search_iterations << ","
+	       << total.local_moves << ","
+	       << total.plateau_moves << ","
+	       << total.local_minimum << ","
+	       << total.resets << ","
+	       << total.restarts << ","
+	       << nodes << ","
+	       << fails << ","
+	       << propagations << ","
+	       << csv_number( number_solutions ) << ","
+	       << interrupted;
+	return stream.str();
+}
+
+std::string SolverStatistics::units_csv_header()
+{
+	return "unit,winning,search_iterations,local_moves,plateau_moves,plateau_force_trying_another_variable,"
+		"local_minimum,resets,restarts,satisfaction_error,optimization_cost";
+}
+
+std::string SolverStatistics::units_to_csv() const
+{
+	std::ostringstream stream;
+	for( int i = 0 ; i < static_cast<int>( units.size() ) ; ++i )
+		stream << i << ","
+		       << ( i == winning_thread ) << ","
+		       << units[i].search_iterations << ","
+		       << units[i].local_moves << ","
+		       << units[i].plateau_moves << ","
+		       << units[i].plateau_force_trying_another_variable << ","
+		       << units[i].local_minimum << ","
+		       << units[i].resets << ","
+		       << units[i].restarts << ","
+		       << csv_number( units[i].satisfaction_error ) << ","
+		       << csv_number( units[i].optimization_cost ) << "\n";
+	return stream.str();
+}
@@ -0,0 +1,222 @@
+/*
+ * GHOST (General meta-Heuristic Optimization Solving Tool) is a C++ framework
+ * designed to help developers to model and implement optimization problem
+ * solving. It contains a meta-heuristic solver aiming to solve any kind of
+ * combinatorial and optimization real-time problems represented by a CSP/COP/EF-CSP/EF-COP. 
+ *
+ * First developed to solve game-related optimization problems, GHOST can be used for
+ * any kind of applications where solving combinatorial and optimization problems. In
+ * particular, it had been designed to be able to solve not-too-complex problem instances
+ * within some milliseconds, making it very suitable for highly reactive or embedded systems.
+ * Please visit https://github.com/richoux/GHOST for further information.
+ *
+ * Copyright (C) 2014-2025 Florian Richoux
+ *
+ * This file is part of GHOST.
+ * GHOST is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * GHOST is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with GHOST. If not, see http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#include "trajectory_recorder.hpp"
+
+using ghost::TrajectoryEvent;
+using ghost::TrajectoryBuffer;
+using ghost::TrajectoryRecorder;
+
+namespace
+{
+	const char magic[] = { 'G', 'H', 'O', 'S', 'T', 'T', 'R', 'J' };
+}
+
+std::string TrajectoryEvent::type_name( int type )
+{
+	switch( type )
+	{
+	case VariableSelected: return "variable_selected";
+	case ValueSelected: return "value_selected";
+	case LocalMove: return "local_move";
+	case PlateauMove: return "plateau_move";
+	case PlateauEscape: return "plateau_escape";
+	case LocalMinimum: return "local_minimum";
+	case Reset: return "reset";
+	case Restart: return "restart";
+	case BestSatisfactionError: return "best_satisfaction_error";
+	case BestOptimizationCost: return "best_optimization_cost";
+	default: return "unknown";
+	}
+}
+
+std::string TrajectoryEvent::to_text() const
+{
+	std::ostringstream stream;
+	stream << "Thread " << unit << ", iteration " << iteration << ": ";
+
+	switch( type )
+	{
+	case VariableSelected:
+		stream << "Picked worst variable: v[" << variable << "]=" << value << ", current error: " << error;
+		break;
+	case ValueSelected:
+		stream << "Picked value for min conflict on v[" << variable << "]: " << value << ", delta: " << delta;
+		break;
+	case LocalMove:
+		stream << "Local move v[" << variable << "] <- " << value << ", error: " << error;
+		break;
+	case PlateauMove:
+		stream << "Plateau move v[" << variable << "] <- " << value << ", error: " << error;
+		break;
+	case PlateauEscape:
+		stream << "Force the exploration of another variable on a plateau; v[" << variable << "] marked as tabu.";
+		break;
+	case LocalMinimum:
+		stream << "Local minimum; v[" << variable << "] marked as tabu, error: " << error;
+		break;
+	case Reset:
+		stream << "Number of resets performed so far: " << value << ", error: " << error;
+		break;
+	case Restart:
+		stream << "Number of restarts performed so far: " << value << ", error: " << error;
+		break;
+	case BestSatisfactionError:
+		stream << "Best satisfaction error so far: " << error;
+		break;
+	case BestOptimizationCost:
+		stream << "Best objective function value so far: " << error;
+		break;
+	default:
+		stream << "Unknown event " << static_cast<int>( type );
+	}
+
+	return stream.str();
+}
+
+std::string TrajectoryEvent::csv_header()
+{
+	return "unit,iteration,event,variable,value,delta,error";
+}
+
+std::string TrajectoryEvent::to_csv() const
+{
+	std::ostringstream stream;
+	stream << unit << ","
+	       << iteration << ","
+	       << type_name( type ) << ","
+	       << variable << ","
+	       << value << ","
+	       << delta << ","
+	       << error;
+	return stream.str();
+}
+
+TrajectoryBuffer::TrajectoryBuffer( int unit, std::size_t capacity )
+	: _events( capacity ),
+	  _mask( capacity - 1 ),
+	  _unit( static_cast<std::uint16_t>( unit ) ),
+	  _head( 0 ),
+	  _cached_tail( 0 ),
+	  _tail( 0 )
+{ }
+
+std::size_t TrajectoryBuffer::flush( std::ofstream& stream )
+{
+	std::size_t tail = _tail.load( std::memory_order_relaxed );
+	std::size_t head = _head.load( std::memory_order_acquire );
+	std::size_t count = head - tail;
+	if( count == 0 )
+		return 0;
+
+	// Events may wrap around the end of the ring
+	std::size_t first = tail & _mask;
+	std::size_t first_chunk = std::min( count, _events.size() - first );
+	stream.write( reinterpret_cast<const char*>( &_events[ first ] ), static_cast<std::streamsize>( first_chunk * sizeof( TrajectoryEvent ) ) );
+	if( first_chunk < count )
+		stream.write( reinterpret_cast<const char*>( &_events[ 0 ] ), static_cast<std::streamsize>( ( count - first_chunk ) * sizeof( TrajectoryEvent ) ) );
+
+	_tail.store( head, std::memory_order_release );
+	return count;
+}
+
+TrajectoryRecorder::TrajectoryRecorder( const std::string& filename, int number_units )
+	: _file( filename, std::ios::binary | std::ios::trunc ),
+	  _stop( false )
+{
+	if( !_file )
+		throw trajectoryFileException( filename, "cannot be opened for writing." );
+
+	std::uint32_t event_size = sizeof( TrajectoryEvent );
+	_file.write( magic, sizeof( magic ) );
+	_file.write( reinterpret_cast<const char*>( &version ), sizeof( version ) );
+	_file.write( reinterpret_cast<const char*>( &event_size ), sizeof( event_size ) );
+
+	for( int unit = 0 ; unit < number_units ; ++unit )
+		_buffers.push_back( std::make_unique<TrajectoryBuffer>( unit, buffer_capacity ) );
+
+	_writer = std::thread( &TrajectoryRecorder::write_loop, this );
+}
+
+TrajectoryRecorder::~TrajectoryRecorder()
+{
+	{
+		std::lock_guard<std::mutex> lock( _stop_mutex );
+		_stop = true;
+	}
+	_stop_signal.notify_one();
+	_writer.join();
+
+	for( auto& buffer : _buffers )
+		buffer->flush( _file );
+}
+
+// Flush by batches: waking up for each event would steal more time from search units than writing them.
+void TrajectoryRecorder::write_loop()
+{
+	std::unique_lock<std::mutex> lock( _stop_mutex );
+	while( !_stop_signal.wait_for( lock, flush_period, [&]{ return _stop; } ) )
+	{
+		lock.unlock();
+		for( auto& buffer : _buffers )
+			buffer->flush( _file );
+		lock.lock();
+	}
+}
+
+std::vector<TrajectoryEvent> TrajectoryRecorder::read( const std::string& filename )
+{
+	std::ifstream file( filename, std::ios::binary );
+	if( !file )
+		throw trajectoryFileException( filename, "cannot be opened for reading." );
+
+	char file_magic[ sizeof( magic ) ];
+	std::uint32_t file_version;
+	std::uint32_t event_size;
+	file.read( file_magic, sizeof( file_magic ) );
+	file.read( reinterpret_cast<char*>( &file_version ), sizeof( file_version ) );
+	file.read( reinterpret_cast<char*>( &event_size ), sizeof( event_size ) );
+
+	if( !file || std::memcmp( file_magic, magic, sizeof( magic ) ) != 0 )
+		throw trajectoryFileException( filename, "not a GHOST trajectory file." );
+	if( file_version != version || event_size != sizeof( TrajectoryEvent ) )
+		throw trajectoryFileException( filename, "unsupported format version " + std::to_string( file_version ) + "." );
+
+	std::vector<TrajectoryEvent> events;
+	TrajectoryEvent event;
+	while( file.read( reinterpret_cast<char*>( &event ), sizeof( event ) ) )
+		events.push_back( event );
+
+	return events;
+}
@@ -65,6 +65,16 @@ Variable::Variable( int starting_value,
 	: Variable( starting_value, size, 0, name )
 { }
 
+void Variable::narrow_domain( const std::vector<int>& domain )
+{
+	_domain = domain;
+	_min_value = *( std::min_element( _domain.begin(), _domain.end() ) );
+	_max_value = *( std::max_element( _domain.begin(), _domain.end() ) );
+
+	if( std::find( _domain.cbegin(), _domain.cend(), _current_value ) == _domain.cend() )
+		_current_value = _domain[0];
+}
+
 std::vector<int> Variable::get_partial_domain( int range ) const
 {
 	if( range >= static_cast<int>( _domain.size() ) )
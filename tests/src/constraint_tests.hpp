@@ -0,0 +1,549 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <ghost/solver.hpp>
+#include <gtest/gtest.h>
+
+// Tag type to specialize ghost::Solver for tests.
+struct ConstraintTests {};
+
+namespace ghost
+{
+	// Solver is a friend of Constraint and Variable for any model builder type.
+	// This specialization gives tests the same access to constraints than the solver.
+	template<> class Solver<ConstraintTests>
+	{
+	public:
+		// Create variables with consecutive ids, like ModelBuilder::build_model.
+		static std::vector<Variable> create_variables( int number, int starting_value, std::size_t size )
+		{
+			std::vector<Variable> variables;
+			for( int variable_id = 0 ; variable_id < number ; ++variable_id )
+			{
+				variables.emplace_back( starting_value, size );
+				variables.back()._id = variable_id;
+			}
+			return variables;
+		}
+
+		static std::vector<Variable> create_variables( int number, const std::vector<int>& domain )
+		{
+			std::vector<Variable> variables;
+			for( int variable_id = 0 ; variable_id < number ; ++variable_id )
+			{
+				variables.emplace_back( domain );
+				variables.back()._id = variable_id;
+			}
+			return variables;
+		}
+
+		// Give the constraint raw pointers to variables, like ModelBuilder::build_model.
+		static void bind( Constraint& constraint, std::vector<Variable>& variables )
+		{
+			constraint._variables.clear();
+			constraint._variables_position.clear();
+			for( int index = 0 ; index < static_cast<int>( constraint._variables_index.size() ) ; ++index )
+			{
+				constraint._variables.push_back( &variables[ constraint._variables_index[ index ] ] );
+				constraint._variables_position[ constraint._variables_index[ index ] ] = index;
+			}
+		}
+
+		// Compute the error of the current assignment, like a search unit does before its first move.
+		static void initialize( Constraint& constraint )
+		{
+			constraint._current_error = constraint.error();
+		}
+
+		static double error( const Constraint& constraint ) { return constraint.error(); }
+
+		static double current_error( const Constraint& constraint ) { return constraint._current_error; }
+
+		static std::vector<int> variable_ids( const Constraint& constraint ) { return constraint.get_variable_ids(); }
+
+		static double delta_error( const Constraint& constraint, const std::vector<int>& variables_index, const std::vector<int>& candidate_values )
+		{
+			return constraint.delta_error( variables_index, candidate_values );
+		}
+
+		// Update data structures before variable_id takes new_value, like SearchUnit::update_constraint.
+		static void update( Constraint& constraint, int variable_id, int new_value ) { constraint.update( variable_id, new_value ); }
+
+		static void add_delta_error( Constraint& constraint, double delta ) { constraint._current_error += delta; }
+
+		// Probe optional_variable_error like SearchUnit::initialize_data_structures.
+		static bool defines_variable_error( const Constraint& constraint )
+		{
+			try
+			{
+				constraint.variable_error( constraint._variables_index[ 0 ] );
+			}
+			catch( const Constraint::variableErrorNotDefinedException& e ) { }
+
+			return constraint._is_optional_variable_error_defined;
+		}
+
+		static double variable_error( const Constraint& constraint, int variable_id ) { return constraint.variable_error( variable_id ); }
+
+		static void variable_error_changes( const Constraint& constraint, int variable_id, int new_value, std::vector<std::pair<int, double>>& error_changes )
+		{
+			constraint.variable_error_changes( variable_id, new_value, error_changes );
+		}
+
+		static bool filter_domains( const Constraint& constraint, std::vector<std::vector<int>>& domains ) { return constraint.filter_domains( domains ); }
+
+		static bool is_swap_invariant( const Constraint& constraint ) { return constraint.optional_is_swap_invariant(); }
+
+		// Give the objective function raw pointers to variables, like ModelBuilder::build_model.
+		static void bind( Objective& objective, std::vector<Variable>& variables )
+		{
+			objective._variables.clear();
+			objective._variables_position.clear();
+			for( int index = 0 ; index < static_cast<int>( objective._variables_index.size() ) ; ++index )
+			{
+				objective._variables.push_back( &variables[ objective._variables_index[ index ] ] );
+				objective._variables_position[ objective._variables_index[ index ] ] = index;
+			}
+		}
+
+		static double cost( const Objective& objective ) { return objective.cost(); }
+
+		static std::vector<int> variable_ids( const Objective& objective ) { return objective._variables_index; }
+
+		// Probe optional_delta_cost like SearchUnit::initialize_data_structures.
+		static bool defines_delta_cost( const Objective& objective )
+		{
+			try
+			{
+				objective.optional_delta_cost( objective._variables, std::vector<int>{0}, std::vector<int>{ objective._variables[0]->get_value() } );
+			}
+			catch( const Objective::deltaCostNotDefinedException& e ) { }
+
+			return objective.is_optional_delta_cost_defined();
+		}
+
+		static double simulate_delta_cost( const Objective& objective, const std::vector<int>& variables_index, const std::vector<int>& candidate_values )
+		{
+			return objective.simulate_delta_cost( variables_index, candidate_values );
+		}
+
+		// Update data structures before variable_id takes new_value, like SearchUnit::update_errors.
+		static void update( Objective& objective, int variable_id, int new_value ) { objective.update( variable_id, new_value ); }
+
+		static std::vector<double> candidate_costs( const Objective& objective, int variable_id, const std::vector<int>& possible_values )
+		{
+			return objective.candidate_costs( objective._variables, objective._variables_position.at( variable_id ), possible_values );
+		}
+
+		static int heuristic_value( const Objective& objective, int variable_id, const std::vector<int>& possible_values, randutils::mt19937_rng& rng )
+		{
+			return objective.heuristic_value( variable_id, possible_values, rng );
+		}
+
+		static bool is_separable( const Objective& objective ) { return objective.optional_is_separable(); }
+
+		static std::vector<int> critical_variables( const Objective& objective ) { return objective.critical_variables(); }
+	};
+}
+
+using Tester = ghost::Solver<ConstraintTests>;
+using ConstraintFactory = std::function<std::shared_ptr<ghost::Constraint>()>;
+using ObjectiveFactory = std::function<std::shared_ptr<ghost::Objective>()>;
+
+inline bool are_close( double value, double expected )
+{
+	return std::abs( value - expected ) <= 1e-9 * std::max( 1.0, std::abs( expected ) );
+}
+
+inline std::vector<int> sorted( std::vector<int> values )
+{
+	std::sort( values.begin(), values.end() );
+	return values;
+}
+
+inline std::string to_string( const std::vector<std::vector<int>>& domains )
+{
+	std::stringstream stream;
+	for( const auto& domain : domains )
+	{
+		stream << "{";
+		for( int i = 0 ; i < static_cast<int>( domain.size() ) ; ++i )
+			stream << ( i == 0 ? "" : "," ) << domain[ i ];
+		stream << "} ";
+	}
+	return stream.str();
+}
+
+/*
+ * Random walk over the values of the constraint's variables, by changing the value of one variable
+ * or by swapping the values of two variables at each move. Checks that the error maintained through
+ * delta errors and data structure updates matches the error of a constraint built from scratch.
+ * If the constraint projects its error onto variables, projected errors are checked the same way.
+ */
+inline ::testing::AssertionResult incremental_errors_match( const ConstraintFactory& make_constraint,
+                                                            std::vector<ghost::Variable>& variables,
+                                                            bool swaps,
+                                                            int number_moves = 2000,
+                                                            unsigned int seed = 0 )
+{
+	std::mt19937 rng( seed );
+	auto random_value = [&]( const ghost::Variable& variable )
+	{
+		auto domain = variable.get_full_domain();
+		return domain[ std::uniform_int_distribution<int>( 0, static_cast<int>( domain.size() ) - 1 )( rng ) ];
+	};
+
+	for( auto& variable : variables )
+		variable.set_value( random_value( variable ) );
+
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+	Tester::initialize( *constraint );
+	auto ids = Tester::variable_ids( *constraint );
+	std::uniform_int_distribution<int> random_position( 0, static_cast<int>( ids.size() ) - 1 );
+
+	bool projections = Tester::defines_variable_error( *constraint );
+	std::vector<double> variable_errors( variables.size(), 0.0 );
+	if( projections )
+		for( int id : ids )
+			variable_errors[ id ] = Tester::variable_error( *constraint, id );
+
+	std::vector<std::pair<int, double>> error_changes;
+	for( int move = 0 ; move < number_moves ; ++move )
+	{
+		std::vector<int> moved;
+		std::vector<int> values;
+		if( swaps )
+		{
+			int first = ids[ random_position( rng ) ];
+			int second = ids[ random_position( rng ) ];
+			auto first_domain = variables[ first ].get_full_domain();
+			auto second_domain = variables[ second ].get_full_domain();
+			if( first == second
+			    || std::find( first_domain.begin(), first_domain.end(), variables[ second ].get_value() ) == first_domain.end()
+			    || std::find( second_domain.begin(), second_domain.end(), variables[ first ].get_value() ) == second_domain.end() )
+				continue;
+
+			moved = { first, second };
+			values = { variables[ second ].get_value(), variables[ first ].get_value() };
+		}
+		else
+		{
+			int id = ids[ random_position( rng ) ];
+			moved = { id };
+			values = { random_value( variables[ id ] ) };
+		}
+
+		// Same order than SearchUnit::update_errors: variables take their new values after all updates.
+		Tester::add_delta_error( *constraint, Tester::delta_error( *constraint, moved, values ) );
+		for( int i = 0 ; i < static_cast<int>( moved.size() ) ; ++i )
+		{
+			if( projections )
+			{
+				Tester::variable_error_changes( *constraint, moved[ i ], values[ i ], error_changes );
+				for( const auto& change : error_changes )
+					variable_errors[ change.first ] += change.second;
+			}
+			Tester::update( *constraint, moved[ i ], values[ i ] );
+		}
+		for( int i = 0 ; i < static_cast<int>( moved.size() ) ; ++i )
+			variables[ moved[ i ] ].set_value( values[ i ] );
+
+		auto fresh_constraint = make_constraint();
+		Tester::bind( *fresh_constraint, variables );
+		double expected = Tester::error( *fresh_constraint );
+		if( !are_close( Tester::current_error( *constraint ), expected ) )
+			return ::testing::AssertionFailure() << "After move " << move << ", the maintained error is " << Tester::current_error( *constraint )
+			                                     << " but the error computed from scratch is " << expected;
+
+		if( projections )
+		{
+			Tester::initialize( *fresh_constraint );
+			for( int id : ids )
+			{
+				double expected_variable_error = Tester::variable_error( *fresh_constraint, id );
+				if( !are_close( variable_errors[ id ], expected_variable_error ) )
+					return ::testing::AssertionFailure() << "After move " << move << ", the maintained error of variable " << id << " is "
+					                                     << variable_errors[ id ] << " but its error computed from scratch is " << expected_variable_error;
+			}
+		}
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+// Random swaps of the values of the constraint's variables. Checks that a swap-invariant constraint keeps the same error.
+inline ::testing::AssertionResult swaps_keep_error( const ConstraintFactory& make_constraint,
+                                                    std::vector<ghost::Variable>& variables,
+                                                    int number_swaps = 500,
+                                                    unsigned int seed = 0 )
+{
+	std::mt19937 rng( seed );
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+	if( !Tester::is_swap_invariant( *constraint ) )
+		return ::testing::AssertionFailure() << "The constraint is not swap-invariant";
+
+	for( auto& variable : variables )
+	{
+		auto domain = variable.get_full_domain();
+		variable.set_value( domain[ std::uniform_int_distribution<int>( 0, static_cast<int>( domain.size() ) - 1 )( rng ) ] );
+	}
+
+	auto ids = Tester::variable_ids( *constraint );
+	std::uniform_int_distribution<int> random_position( 0, static_cast<int>( ids.size() ) - 1 );
+	double error = Tester::error( *constraint );
+	for( int swap = 0 ; swap < number_swaps ; ++swap )
+	{
+		auto& first = variables[ ids[ random_position( rng ) ] ];
+		auto& second = variables[ ids[ random_position( rng ) ] ];
+		auto first_domain = first.get_full_domain();
+		auto second_domain = second.get_full_domain();
+		if( std::find( first_domain.begin(), first_domain.end(), second.get_value() ) == first_domain.end()
+		    || std::find( second_domain.begin(), second_domain.end(), first.get_value() ) == second_domain.end() )
+			continue;
+
+		int value = first.get_value();
+		first.set_value( second.get_value() );
+		second.set_value( value );
+		if( Tester::error( *constraint ) != error )
+			return ::testing::AssertionFailure() << "After swap " << swap << ", the error changes from " << error << " to " << Tester::error( *constraint );
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+/*
+ * Enumerate all assignments of the given domains, domains[i] being the domain of the i-th variable
+ * of the constraint. Checks that filtering never removes a value belonging to a solution. If at most
+ * one domain is not a singleton, also checks that filtering removes all values without solution,
+ * as required by Constraint::optional_filter_domains.
+ */
+inline ::testing::AssertionResult filter_keeps_supports( const ConstraintFactory& make_constraint,
+                                                         std::vector<ghost::Variable>& variables,
+                                                         const std::vector<std::vector<int>>& domains )
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+	auto ids = Tester::variable_ids( *constraint );
+
+	std::vector<std::vector<int>> supports( domains.size() );
+	std::vector<int> positions( domains.size(), 0 );
+	bool has_solution = false;
+	bool done = false;
+	while( !done )
+	{
+		for( int i = 0 ; i < static_cast<int>( ids.size() ) ; ++i )
+			variables[ ids[ i ] ].set_value( domains[ i ][ positions[ i ] ] );
+
+		if( Tester::error( *constraint ) == 0.0 )
+		{
+			has_solution = true;
+			for( int i = 0 ; i < static_cast<int>( ids.size() ) ; ++i )
+				supports[ i ].push_back( domains[ i ][ positions[ i ] ] );
+		}
+
+		done = true;
+		for( int i = 0 ; i < static_cast<int>( positions.size() ) && done ; ++i )
+			if( ++positions[ i ] < static_cast<int>( domains[ i ].size() ) )
+				done = false;
+			else
+				positions[ i ] = 0;
+	}
+
+	auto filtered_domains = domains;
+	auto filtering_constraint = make_constraint();
+	Tester::bind( *filtering_constraint, variables );
+	bool consistent = Tester::filter_domains( *filtering_constraint, filtered_domains );
+
+	for( int i = 0 ; i < static_cast<int>( ids.size() ) ; ++i )
+		for( int value : supports[ i ] )
+			if( std::find( filtered_domains[ i ].begin(), filtered_domains[ i ].end(), value ) == filtered_domains[ i ].end() )
+				return ::testing::AssertionFailure() << "Filtering domains " << to_string( domains ) << "gives " << to_string( filtered_domains )
+				                                     << "but value " << value << " of variable " << i << " belongs to a solution";
+
+	int number_free_variables = static_cast<int>( std::count_if( domains.begin(), domains.end(), []( const auto& domain ){ return domain.size() > 1; } ) );
+	if( number_free_variables <= 1 )
+	{
+		if( consistent != has_solution )
+			return ::testing::AssertionFailure() << "Filtering domains " << to_string( domains ) << "gives " << to_string( filtered_domains )
+			                                     << "but they " << ( has_solution ? "have" : "do not have" ) << " a solution";
+
+		for( int i = 0 ; i < static_cast<int>( ids.size() ) && consistent ; ++i )
+			for( int value : filtered_domains[ i ] )
+				if( std::find( supports[ i ].begin(), supports[ i ].end(), value ) == supports[ i ].end() )
+					return ::testing::AssertionFailure() << "Filtering domains " << to_string( domains ) << "gives " << to_string( filtered_domains )
+					                                     << "but value " << value << " of variable " << i << " does not belong to any solution";
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+// Check filter_keeps_supports on random subsets of the variables' domains, half of them being singletons.
+inline ::testing::AssertionResult filter_keeps_supports( const ConstraintFactory& make_constraint,
+                                                         std::vector<ghost::Variable>& variables,
+                                                         int number_trials = 300,
+                                                         unsigned int seed = 0 )
+{
+	std::mt19937 rng( seed );
+	auto ids = Tester::variable_ids( *make_constraint() );
+
+	for( int trial = 0 ; trial < number_trials ; ++trial )
+	{
+		std::vector<std::vector<int>> domains;
+		for( int id : ids )
+		{
+			auto domain = variables[ id ].get_full_domain();
+			std::shuffle( domain.begin(), domain.end(), rng );
+			int size = std::bernoulli_distribution( 0.5 )( rng ) ? 1 : std::uniform_int_distribution<int>( 1, static_cast<int>( domain.size() ) )( rng );
+			domain.resize( size );
+			domains.push_back( domain );
+		}
+
+		auto result = filter_keeps_supports( make_constraint, variables, domains );
+		if( !result )
+			return result;
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+/*
+ * Random walk over the values of all variables, by changing the value of one variable or by swapping
+ * the values of two variables at each move, including variables out of the scope of the objective function.
+ * Checks that the cost maintained through delta costs and data structure updates matches the cost of
+ * an objective function built from scratch.
+ */
+inline ::testing::AssertionResult incremental_costs_match( const ObjectiveFactory& make_objective,
+                                                           std::vector<ghost::Variable>& variables,
+                                                           bool swaps,
+                                                           int number_moves = 2000,
+                                                           unsigned int seed = 0 )
+{
+	std::mt19937 rng( seed );
+	auto random_value = [&]( const ghost::Variable& variable )
+	{
+		auto domain = variable.get_full_domain();
+		return domain[ std::uniform_int_distribution<int>( 0, static_cast<int>( domain.size() ) - 1 )( rng ) ];
+	};
+
+	for( auto& variable : variables )
+		variable.set_value( random_value( variable ) );
+
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	double cost = Tester::cost( *objective );
+	Tester::defines_delta_cost( *objective );
+	std::uniform_int_distribution<int> random_id( 0, static_cast<int>( variables.size() ) - 1 );
+
+	for( int move = 0 ; move < number_moves ; ++move )
+	{
+		std::vector<int> moved;
+		std::vector<int> values;
+		if( swaps )
+		{
+			int first = random_id( rng );
+			int second = random_id( rng );
+			if( first == second )
+				continue;
+
+			moved = { first, second };
+			values = { variables[ second ].get_value(), variables[ first ].get_value() };
+		}
+		else
+		{
+			int id = random_id( rng );
+			moved = { id };
+			values = { random_value( variables[ id ] ) };
+		}
+
+		// Same order than SearchUnit::update_errors: variables take their new values after all updates.
+		cost += Tester::simulate_delta_cost( *objective, moved, values );
+		for( int i = 0 ; i < static_cast<int>( moved.size() ) ; ++i )
+			Tester::update( *objective, moved[ i ], values[ i ] );
+		for( int i = 0 ; i < static_cast<int>( moved.size() ) ; ++i )
+			variables[ moved[ i ] ].set_value( values[ i ] );
+
+		auto fresh_objective = make_objective();
+		Tester::bind( *fresh_objective, variables );
+		double expected = Tester::cost( *fresh_objective );
+		if( !are_close( cost, expected ) )
+			return ::testing::AssertionFailure() << "After move " << move << ", the maintained cost is " << cost
+			                                     << " but the cost computed from scratch is " << expected;
+	}
+
+	return ::testing::AssertionSuccess();
+}
+
+/*
+ * Random assignments of all variables. Checks that the candidate costs of the values of a variable
+ * in the scope of the objective function match the costs of objective functions built from scratch,
+ * up to a constant, without changing the variable. Also checks that the value heuristic picks one of
+ * the values with the lowest cost.
+ */
+inline ::testing::AssertionResult candidate_costs_match( const ObjectiveFactory& make_objective,
+                                                         std::vector<ghost::Variable>& variables,
+                                                         int number_trials = 200,
+                                                         unsigned int seed = 0 )
+{
+	std::mt19937 rng( seed );
+	randutils::mt19937_rng heuristic_rng( seed );
+	auto ids = Tester::variable_ids( *make_objective() );
+	std::uniform_int_distribution<int> random_position( 0, static_cast<int>( ids.size() ) - 1 );
+
+	for( int trial = 0 ; trial < number_trials ; ++trial )
+	{
+		for( auto& variable : variables )
+		{
+			auto domain = variable.get_full_domain();
+			variable.set_value( domain[ std::uniform_int_distribution<int>( 0, static_cast<int>( domain.size() ) - 1 )( rng ) ] );
+		}
+
+		auto objective = make_objective();
+		Tester::bind( *objective, variables );
+		Tester::cost( *objective );
+		Tester::defines_delta_cost( *objective );
+
+		int id = ids[ random_position( rng ) ];
+		int value = variables[ id ].get_value();
+		auto domain = variables[ id ].get_full_domain();
+		auto costs = Tester::candidate_costs( *objective, id, domain );
+		int heuristic_value = Tester::heuristic_value( *objective, id, domain, heuristic_rng );
+		if( variables[ id ].get_value() != value )
+			return ::testing::AssertionFailure() << "In trial " << trial << ", evaluating candidate values changes variable " << id;
+
+		std::vector<double> expected_costs;
+		for( int candidate : domain )
+		{
+			variables[ id ].set_value( candidate );
+			auto fresh_objective = make_objective();
+			Tester::bind( *fresh_objective, variables );
+			expected_costs.push_back( Tester::cost( *fresh_objective ) );
+		}
+		variables[ id ].set_value( value );
+
+		// Candidate costs are not negated for maximization, unlike cost().
+		double sign = objective->is_maximization() ? -1.0 : 1.0;
+		for( int i = 0 ; i < static_cast<int>( domain.size() ) ; ++i )
+			if( !are_close( sign * ( costs[ i ] - costs[ 0 ] ), expected_costs[ i ] - expected_costs[ 0 ] ) )
+				return ::testing::AssertionFailure() << "In trial " << trial << ", the candidate cost of value " << domain[ i ] << " of variable " << id
+				                                     << " differs from the candidate cost of value " << domain[ 0 ] << " by " << sign * ( costs[ i ] - costs[ 0 ] )
+				                                     << " but their costs computed from scratch differ by " << expected_costs[ i ] - expected_costs[ 0 ];
+
+		double best_cost = *std::min_element( expected_costs.begin(), expected_costs.end() );
+		double heuristic_cost = expected_costs[ std::find( domain.begin(), domain.end(), heuristic_value ) - domain.begin() ];
+		if( !are_close( heuristic_cost, best_cost ) )
+			return ::testing::AssertionFailure() << "In trial " << trial << ", the heuristic picks value " << heuristic_value << " of variable " << id
+			                                     << " with cost " << heuristic_cost << " but the lowest cost is " << best_cost;
+	}
+
+	return ::testing::AssertionSuccess();
+}
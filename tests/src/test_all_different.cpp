@@ -0,0 +1,68 @@
+#include <ghost/global_constraints/all_different.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+
+#include "constraint_tests.hpp"
+
+class AllDifferentTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 5, 0, 5 );
+
+	ConstraintFactory make_constraint = [](){ return std::make_shared<ghost::global_constraints::AllDifferent>( std::vector<int>{ 0, 1, 2, 3, 4 } ); };
+};
+
+TEST_F(AllDifferentTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+TEST_F(AllDifferentTest, FilterHallInterval)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	std::vector<std::vector<int>> domains{ { 1, 2 }, { 1, 2 }, { 0, 1, 2, 3 }, { 2, 3, 4 }, { 0, 1, 2, 3, 4 } };
+	EXPECT_TRUE( Tester::filter_domains( *constraint, domains ) );
+	EXPECT_THAT( sorted( domains[2] ), ::testing::ElementsAre( 0, 3 ) );
+	EXPECT_THAT( sorted( domains[3] ), ::testing::ElementsAre( 3, 4 ) );
+
+	domains = { { 1, 2 }, { 1, 2 }, { 1, 2 }, { 3 }, { 4 } };
+	EXPECT_FALSE( Tester::filter_domains( *constraint, domains ) );
+}
+
+TEST_F(AllDifferentTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+
+	// Values far from 0 and a scope not starting at the first variable
+	auto other_variables = Tester::create_variables( 8, -1000, 6 );
+	ConstraintFactory make_other_constraint = [](){ return std::make_shared<ghost::global_constraints::AllDifferent>( std::vector<int>{ 7, 2, 4, 5, 1 } ); };
+	EXPECT_TRUE( incremental_errors_match( make_other_constraint, other_variables, false ) );
+}
+
+TEST_F(AllDifferentTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(AllDifferentTest, DeltaErrorsSparseDomains)
+{
+	// Domains spanning most of the int range must neither overflow nor allocate a count per value of the span
+	auto sparse_variables = Tester::create_variables( 5, std::vector<int>{ std::numeric_limits<int>::min(), -1, 0, 2000000000, std::numeric_limits<int>::max() } );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, true ) );
+}
+
+TEST_F(AllDifferentTest, SwapInvariance)
+{
+	EXPECT_TRUE( swaps_keep_error( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
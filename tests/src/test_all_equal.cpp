@@ -0,0 +1,68 @@
+#include <ghost/global_constraints/all_equal.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+
+#include "constraint_tests.hpp"
+
+class AllEqualTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 4, 0, 5 );
+
+	ConstraintFactory make_constraint = [](){ return std::make_shared<ghost::global_constraints::AllEqual>( std::vector<int>{ 0, 1, 2, 3 } ); };
+};
+
+TEST_F(AllEqualTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+TEST_F(AllEqualTest, FilterIntersection)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	std::vector<std::vector<int>> domains{ { 1, 2, 3 }, { 0, 2, 3 }, { 3, 4, 2 }, { 0, 1, 2, 3, 4 } };
+	EXPECT_TRUE( Tester::filter_domains( *constraint, domains ) );
+	for( const auto& domain : domains )
+		EXPECT_THAT( sorted( domain ), ::testing::ElementsAre( 2, 3 ) );
+
+	domains = { { 1, 2 }, { 3, 4 }, { 1, 2, 3, 4 }, { 1 } };
+	EXPECT_FALSE( Tester::filter_domains( *constraint, domains ) );
+}
+
+TEST_F(AllEqualTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+
+	// Few values, so that frequencies often tie
+	auto other_variables = Tester::create_variables( 9, 40, 2 );
+	ConstraintFactory make_other_constraint = [](){ return std::make_shared<ghost::global_constraints::AllEqual>( std::vector<int>{ 8, 0, 3, 4, 6, 2 } ); };
+	EXPECT_TRUE( incremental_errors_match( make_other_constraint, other_variables, false ) );
+}
+
+TEST_F(AllEqualTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(AllEqualTest, DeltaErrorsSparseDomains)
+{
+	// Domains spanning most of the int range must neither overflow nor allocate a count per value of the span
+	auto sparse_variables = Tester::create_variables( 5, std::vector<int>{ std::numeric_limits<int>::min(), -1, 0, 2000000000, std::numeric_limits<int>::max() } );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, true ) );
+}
+
+TEST_F(AllEqualTest, SwapInvariance)
+{
+	EXPECT_TRUE( swaps_keep_error( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
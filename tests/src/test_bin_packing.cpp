@@ -0,0 +1,68 @@
+#include <ghost/global_constraints/bin_packing.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class BinPackingTest : public ::testing::Test
+{
+public:
+	// Bins -1 and 3 do not exist
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, -1, 5 );
+	std::vector<int> sizes{ 2, 3, 1, 4, 2 };
+	std::vector<int> capacities{ 4, 3, 5 };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::BinPacking>( std::vector<int>{ 5, 0, 1, 3, 4 }, sizes, capacities ); };
+};
+
+TEST_F(BinPackingTest, Errors)
+{
+	auto constraint = std::make_shared<ghost::global_constraints::BinPacking>( std::vector<int>{ 0, 1, 2, 3, 4 }, sizes, capacities );
+	Tester::bind( *constraint, variables );
+
+	// Bin 0 holds items 0, 1 and 2 for a load of 6, bin 2 holds item 4, and item 3 is in no bin
+	for( int i = 0 ; i < 5 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 0, 0, 0, 3, 2 }[ i ] );
+	Tester::initialize( *constraint );
+	EXPECT_EQ( Tester::error( *constraint ), 6 );
+
+	EXPECT_TRUE( Tester::defines_variable_error( *constraint ) );
+	EXPECT_EQ( Tester::variable_error( *constraint, 0 ), 2 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 2 ), 2 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 3 ), 4 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 4 ), 0 );
+}
+
+TEST_F(BinPackingTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_constraints::BinPacking( std::vector<int>{ 0, 1, 2 }, { 2, 3 }, capacities ), std::exception );
+}
+
+TEST_F(BinPackingTest, DeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(BinPackingTest, SwapDeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(BinPackingTest, SwapInvariance)
+{
+	EXPECT_FALSE( Tester::is_swap_invariant( *make_constraint() ) );
+
+	ConstraintFactory make_uniform_constraint = [&](){ return std::make_shared<ghost::global_constraints::BinPacking>( std::vector<int>{ 0, 1, 2, 3 }, std::vector<int>{ 2, 2, 2, 2 }, capacities ); };
+	EXPECT_TRUE( swaps_keep_error( make_uniform_constraint, variables ) );
+}
+
+TEST_F(BinPackingTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <ghost/global_objectives/bottleneck_objective.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class BottleneckObjectiveTest : public ::testing::Test
+{
+public:
+	// Variables 1 and 4 are out of the scope of the objective function.
+	std::vector<ghost::Variable> variables = Tester::create_variables( 7, 0, 4 );
+	std::vector<int> scope{ 0, 2, 3, 5, 6 };
+	std::vector<double> coefficients{ 2.0, 1.0, -1.0, 0.5, 2.0 };
+	std::vector<double> offsets{ 0.0, 2.0, 3.0, 1.0, -1.0 };
+
+	ObjectiveFactory make_max = [&](){ return std::make_shared<ghost::global_objectives::MinimizeMax>( scope, coefficients, offsets ); };
+	ObjectiveFactory make_min = [&](){ return std::make_shared<ghost::global_objectives::MaximizeMin>( scope, coefficients, offsets ); };
+
+	std::vector<double> terms()
+	{
+		std::vector<double> values;
+		for( int i = 0 ; i < static_cast<int>( scope.size() ) ; ++i )
+			values.push_back( coefficients[ i ] * variables[ scope[ i ] ].get_value() + offsets[ i ] );
+		return values;
+	}
+};
+
+TEST_F(BottleneckObjectiveTest, Cost)
+{
+	for( int id = 0 ; id < 7 ; ++id )
+		variables[ id ].set_value( id % 4 );
+
+	// Terms are 0, 4, 0, 1.5 and 3.
+	auto minimize_max = make_max();
+	Tester::bind( *minimize_max, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *minimize_max ), 4.0 );
+
+	auto maximize_min = make_min();
+	Tester::bind( *maximize_min, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *maximize_min ), 0.0 );
+
+	ghost::global_objectives::MinimizeMax variables_max( scope );
+	Tester::bind( variables_max, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( variables_max ), 3.0 );
+}
+
+TEST_F(BottleneckObjectiveTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_objectives::MinimizeMax( scope, { 1.0, 2.0 }, offsets ), std::exception );
+	EXPECT_THROW( ghost::global_objectives::MaximizeMin( scope, coefficients, { 0.0 } ), std::exception );
+	EXPECT_THROW( ghost::global_objectives::MinimizeMax( Tester::create_variables( 3, 0, 4 ), coefficients, offsets ), std::exception );
+}
+
+TEST_F(BottleneckObjectiveTest, DeltaCosts)
+{
+	auto objective = make_max();
+	Tester::bind( *objective, variables );
+	Tester::cost( *objective );
+	EXPECT_TRUE( Tester::defines_delta_cost( *objective ) );
+
+	EXPECT_TRUE( incremental_costs_match( make_max, variables, false ) );
+	EXPECT_TRUE( incremental_costs_match( make_min, variables, false ) );
+}
+
+TEST_F(BottleneckObjectiveTest, SwapDeltaCosts)
+{
+	EXPECT_TRUE( incremental_costs_match( make_max, variables, true ) );
+	EXPECT_TRUE( incremental_costs_match( make_min, variables, true ) );
+}
+
+TEST_F(BottleneckObjectiveTest, CriticalVariables)
+{
+	std::mt19937 rng( 0 );
+	std::uniform_int_distribution<int> random_id( 0, 6 );
+	std::uniform_int_distribution<int> random_value( 0, 3 );
+
+	for( const auto& make_objective : { make_max, make_min } )
+	{
+		auto objective = make_objective();
+		Tester::bind( *objective, variables );
+		Tester::cost( *objective );
+		bool is_max = !objective->is_maximization();
+
+		for( int move = 0 ; move < 500 ; ++move )
+		{
+			int id = random_id( rng );
+			int value = random_value( rng );
+			Tester::update( *objective, id, value );
+			variables[ id ].set_value( value );
+
+			auto values = terms();
+			double bottleneck = is_max ? *std::max_element( values.begin(), values.end() ) : *std::min_element( values.begin(), values.end() );
+			std::vector<int> expected;
+			for( int i = 0 ; i < static_cast<int>( scope.size() ) ; ++i )
+				if( values[ i ] == bottleneck )
+					expected.push_back( scope[ i ] );
+
+			ASSERT_EQ( sorted( Tester::critical_variables( *objective ) ), expected ) << "After move " << move;
+		}
+	}
+}
+
+TEST_F(BottleneckObjectiveTest, CandidateCosts)
+{
+	EXPECT_TRUE( candidate_costs_match( make_max, variables ) );
+	EXPECT_TRUE( candidate_costs_match( make_min, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
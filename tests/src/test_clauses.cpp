@@ -0,0 +1,80 @@
+#include <ghost/global_constraints/clauses.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class ClausesTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 5, 0, 2 );
+	// (x1 or not x2) and (x2 or x3 or not x4) and (not x1 or x4) and (not x3) and (x1 or x2 or x3 or x4), over variables 4, 0, 2, 1
+	std::vector<std::vector<int>> clauses{ { 1, -2 }, { 2, 3, -4 }, { -1, 4 }, { -3 }, { 1, 2, 3, 4 } };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::Clauses>( std::vector<int>{ 4, 0, 2, 1 }, clauses ); };
+};
+
+TEST_F(ClausesTest, Errors)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	// x1 = false, x2 = true, x3 = true, x4 = false
+	variables[ 4 ].set_value( 0 );
+	variables[ 0 ].set_value( 1 );
+	variables[ 2 ].set_value( 1 );
+	variables[ 1 ].set_value( 0 );
+	Tester::initialize( *constraint );
+	EXPECT_EQ( Tester::error( *constraint ), 2 );
+
+	// Unsatisfied clauses are (x1 or not x2) and (not x3)
+	EXPECT_TRUE( Tester::defines_variable_error( *constraint ) );
+	EXPECT_EQ( Tester::variable_error( *constraint, 4 ), 1 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 0 ), 1 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 2 ), 1 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 1 ), 0 );
+}
+
+TEST_F(ClausesTest, LiteralOutOfScope)
+{
+	EXPECT_THROW( ghost::global_constraints::Clauses( std::vector<int>{ 0, 1 }, { { 1, 3 } } ), std::exception );
+	EXPECT_THROW( ghost::global_constraints::Clauses( std::vector<int>{ 0, 1 }, { { 1 }, { -2, -3 } } ), std::exception );
+}
+
+TEST_F(ClausesTest, ZeroLiteral)
+{
+	EXPECT_THROW( ghost::global_constraints::Clauses( std::vector<int>{ 0, 1 }, { { 1, 0 } } ), std::exception );
+}
+
+TEST_F(ClausesTest, EmptyClause)
+{
+	EXPECT_THROW( ghost::global_constraints::Clauses( std::vector<int>{ 0, 1 }, { { 1, 2 }, {} } ), std::exception );
+}
+
+TEST_F(ClausesTest, DeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+
+	// Any non-zero value is true
+	auto integer_variables = Tester::create_variables( 5, -1, 3 );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, integer_variables, false ) );
+}
+
+TEST_F(ClausesTest, SwapDeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(ClausesTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+
+	auto integer_variables = Tester::create_variables( 5, -1, 3 );
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, integer_variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
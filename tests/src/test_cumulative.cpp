@@ -0,0 +1,60 @@
+#include <ghost/global_constraints/cumulative.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class CumulativeTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, -3, 12 );
+	std::vector<int> durations{ 3, 1, 4, 2, 5 };
+	std::vector<int> demands{ 2, 3, 1, 2, 4 };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::Cumulative>( std::vector<int>{ 0, 2, 3, 4, 5 }, durations, demands, 4 ); };
+};
+
+TEST_F(CumulativeTest, Error)
+{
+	auto constraint = std::make_shared<ghost::global_constraints::Cumulative>( std::vector<int>{ 0, 1, 2 }, std::vector<int>{ 3, 2, 1 }, std::vector<int>{ 2, 2, 1 }, 3 );
+	Tester::bind( *constraint, variables );
+
+	// Loads are 4, 5, 2 at times 0, 1, 2
+	variables[0].set_value( 0 );
+	variables[1].set_value( 0 );
+	variables[2].set_value( 1 );
+	EXPECT_EQ( Tester::error( *constraint ), 3 );
+
+	variables[1].set_value( 3 );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+}
+
+TEST_F(CumulativeTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_constraints::Cumulative( std::vector<int>{ 0, 1, 2 }, { 3, 1 }, { 2, 3, 1 }, 4 ), std::exception );
+	EXPECT_THROW( ghost::global_constraints::Cumulative( std::vector<int>{ 0, 1, 2 }, { 3, 1, 4 }, { 2, 3, 1, 2 }, 4 ), std::exception );
+}
+
+TEST_F(CumulativeTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(CumulativeTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(CumulativeTest, SwapInvariance)
+{
+	EXPECT_FALSE( Tester::is_swap_invariant( *make_constraint() ) );
+
+	ConstraintFactory make_uniform_constraint = [](){ return std::make_shared<ghost::global_constraints::Cumulative>( std::vector<int>{ 0, 1, 2, 3 }, std::vector<int>{ 2, 2, 2, 2 }, std::vector<int>{ 3, 3, 3, 3 }, 5 ); };
+	EXPECT_TRUE( swaps_keep_error( make_uniform_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
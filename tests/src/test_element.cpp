@@ -0,0 +1,57 @@
+#include <ghost/global_constraints/element.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class ElementTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, -1, 6 );
+
+	// x = ( v5, v0, v2 ), z = v3 refering to x[0] with the value 1, y = v1
+	ConstraintFactory make_constraint = [](){ return std::make_shared<ghost::global_constraints::Element>( std::vector<int>{ 5, 0, 2 }, 3, 1, 1 ); };
+};
+
+TEST_F(ElementTest, Error)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	for( int i = 0 ; i < 6 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 4, 3, 0, 2, -1, 1 }[ i ] );
+	EXPECT_EQ( Tester::error( *constraint ), 1 );
+
+	variables[ 1 ].set_value( 4 );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+
+	// z = -1 is 2 away from the valid index 1, refering to x[0] = 1
+	variables[ 3 ].set_value( -1 );
+	EXPECT_EQ( Tester::error( *constraint ), 5 );
+}
+
+TEST_F(ElementTest, EmptyArray)
+{
+	EXPECT_THROW( ghost::global_constraints::Element( std::vector<int>{}, 3, 1 ), std::exception );
+}
+
+TEST_F(ElementTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(ElementTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(ElementTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
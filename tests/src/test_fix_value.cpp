@@ -0,0 +1,43 @@
+#include <ghost/global_constraints/fix_value.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class FixValueTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 3, 0, 5 );
+
+	ConstraintFactory make_constraint = [](){ return std::make_shared<ghost::global_constraints::FixValue>( std::vector<int>{ 0, 1, 2 }, 2 ); };
+};
+
+TEST_F(FixValueTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+TEST_F(FixValueTest, FilterAssignsValue)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	std::vector<std::vector<int>> domains{ { 1, 2, 3 }, { 2 }, { 4, 2 } };
+	EXPECT_TRUE( Tester::filter_domains( *constraint, domains ) );
+	for( const auto& domain : domains )
+		EXPECT_THAT( domain, ::testing::ElementsAre( 2 ) );
+
+	domains = { { 1, 2, 3 }, { 0, 1 }, { 2 } };
+	EXPECT_FALSE( Tester::filter_domains( *constraint, domains ) );
+}
+
+TEST_F(FixValueTest, SwapInvariance)
+{
+	EXPECT_TRUE( swaps_keep_error( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
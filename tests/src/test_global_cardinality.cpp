@@ -0,0 +1,80 @@
+#include <ghost/global_constraints/global_cardinality.hpp>
+#include <ghost/global_constraints/at_least.hpp>
+#include <ghost/global_constraints/at_most.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+using namespace ghost::global_constraints;
+
+class GlobalCardinalityTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 5, 0, 5 );
+	std::vector<int> variables_index{ 0, 1, 2, 3, 4 };
+
+	std::vector<ConstraintFactory> make_constraints
+	{
+		[&](){ return std::make_shared<GlobalCardinality>( variables_index, std::vector<int>{ 1, 3, 4 }, std::vector<int>{ 1, 0, 2 }, std::vector<int>{ 2, 1, 3 } ); },
+		[&](){ return std::make_shared<GlobalCardinality>( variables_index, std::vector<int>{ 0, 2 }, std::vector<int>{ 2, 1 } ); },
+		[&](){ return std::make_shared<AtLeast>( std::vector<int>{ 4, 1, 3 }, 2, 2 ); },
+		[&](){ return std::make_shared<AtMost>( variables_index, 0, 1 ); }
+	};
+};
+
+TEST_F(GlobalCardinalityTest, Error)
+{
+	auto constraint = make_constraints[0]();
+	Tester::bind( *constraint, variables );
+
+	// Value 1 appears 3 times, value 3 never and value 4 once
+	for( int i = 0 ; i < 5 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 1, 1, 1, 4, 0 }[ i ] );
+	EXPECT_EQ( Tester::error( *constraint ), 2 );
+
+	variables[ 2 ].set_value( 4 );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+}
+
+TEST_F(GlobalCardinalityTest, SizeMismatch)
+{
+	EXPECT_THROW( GlobalCardinality( variables_index, { 1, 3, 4 }, { 1, 0 }, { 2, 1, 3 } ), std::exception );
+	EXPECT_THROW( GlobalCardinality( variables_index, { 1, 3, 4 }, { 1, 0, 2 }, { 2, 1 } ), std::exception );
+	EXPECT_THROW( GlobalCardinality( variables_index, { 1, 3 }, { 1, 0, 2 } ), std::exception );
+}
+
+TEST_F(GlobalCardinalityTest, DuplicatedValue)
+{
+	EXPECT_THROW( GlobalCardinality( variables_index, { 1, 3, 1 }, { 1, 0, 2 }, { 2, 1, 3 } ), std::exception );
+}
+
+TEST_F(GlobalCardinalityTest, DeltaErrors)
+{
+	for( const auto& make_constraint : make_constraints )
+		EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(GlobalCardinalityTest, SwapDeltaErrors)
+{
+	for( const auto& make_constraint : make_constraints )
+		EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(GlobalCardinalityTest, FilterKeepsSupports)
+{
+	for( const auto& make_constraint : make_constraints )
+		EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+TEST_F(GlobalCardinalityTest, SwapInvariance)
+{
+	for( const auto& make_constraint : make_constraints )
+		EXPECT_TRUE( swaps_keep_error( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+#include <ghost/global_constraints/inverse.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class InverseTest : public ::testing::Test
+{
+public:
+	// Values 1, 2, 3 refer to positions 0, 1, 2, and 0 and 4 are out of range
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, 0, 5 );
+
+	// x = ( v0, v2, v4 ) and y = ( v5, v3, v1 )
+	ConstraintFactory make_constraint = [](){ return std::make_shared<ghost::global_constraints::Inverse>( std::vector<int>{ 0, 2, 4 }, std::vector<int>{ 5, 3, 1 }, 1 ); };
+};
+
+TEST_F(InverseTest, Error)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	// x = ( 2, 3, 1 ) and y = ( 3, 1, 2 ) are inverse permutations
+	for( int i = 0 ; i < 6 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 2, 2, 3, 1, 1, 3 }[ i ] );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+
+	// Only the pair ( x[0], y[1] ) remains matched
+	variables[ 2 ].set_value( 4 );
+	variables[ 5 ].set_value( 2 );
+	EXPECT_EQ( Tester::error( *constraint ), 4 );
+}
+
+TEST_F(InverseTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_constraints::Inverse( std::vector<int>{ 0, 2, 4 }, std::vector<int>{ 5, 3 } ), std::exception );
+	EXPECT_THROW( ghost::global_constraints::Inverse( Tester::create_variables( 2, 0, 2 ), Tester::create_variables( 3, 0, 3 ) ), std::exception );
+}
+
+TEST_F(InverseTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(InverseTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(InverseTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
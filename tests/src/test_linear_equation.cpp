@@ -0,0 +1,90 @@
+#include <ghost/global_constraints/linear_equation_eq.hpp>
+#include <ghost/global_constraints/linear_equation_neq.hpp>
+#include <ghost/global_constraints/linear_equation_leq.hpp>
+#include <ghost/global_constraints/linear_equation_geq.hpp>
+#include <ghost/global_constraints/linear_equation_l.hpp>
+#include <ghost/global_constraints/linear_equation_g.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+using namespace ghost::global_constraints;
+
+class LinearEquationTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 4, -2, 5 );
+	std::vector<int> variables_index{ 0, 1, 2, 3 };
+	std::vector<double> coefficients{ 3, -1, 2, 1 };
+
+	// Constraints of the family on the same scope, with and without coefficients.
+	std::vector<ConstraintFactory> make_constraints
+	{
+		[&](){ return std::make_shared<LinearEquationEq>( variables_index, 3, coefficients ); },
+		[&](){ return std::make_shared<LinearEquationEq>( variables_index, 2 ); },
+		[&](){ return std::make_shared<LinearEquationNeq>( variables_index, 0, coefficients ); },
+		[&](){ return std::make_shared<LinearEquationLeq>( variables_index, -6, coefficients ); },
+		[&](){ return std::make_shared<LinearEquationGeq>( variables_index, 5 ); },
+		[&](){ return std::make_shared<LinearEquationL>( variables_index, -4 ); },
+		[&](){ return std::make_shared<LinearEquationG>( variables_index, 9, coefficients ); }
+	};
+};
+
+TEST_F(LinearEquationTest, FilterKeepsSupports)
+{
+	for( const auto& make_constraint : make_constraints )
+		EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+TEST_F(LinearEquationTest, FilterBounds)
+{
+	auto constraint = std::make_shared<LinearEquationLeq>( variables_index, -6, coefficients );
+	Tester::bind( *constraint, variables );
+
+	// 3a - b + 2c + d <= -6 with b <= 2 and c, d >= -2
+	std::vector<std::vector<int>> domains{ { -2, -1, 0, 1, 2 }, { -2, -1, 0, 1, 2 }, { -2, -1, 0, 1, 2 }, { -2, -1, 0, 1, 2 } };
+	EXPECT_TRUE( Tester::filter_domains( *constraint, domains ) );
+	EXPECT_THAT( domains[0], ::testing::ElementsAre( -2, -1, 0 ) );
+}
+
+TEST_F(LinearEquationTest, DeltaErrors)
+{
+	for( const auto& make_constraint : make_constraints )
+	{
+		EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+		EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+	}
+}
+
+TEST_F(LinearEquationTest, DeltaErrorsRealCoefficients)
+{
+	std::vector<double> real_coefficients{ 0.1, -2.7, 1.0 / 3, 12.5 };
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<LinearEquationEq>( variables_index, 0.3, real_coefficients ); };
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false, 20000 ) );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true, 20000 ) );
+}
+
+TEST_F(LinearEquationTest, DeltaErrorsWideDomains)
+{
+	// Differences of values do not fit into an int
+	auto wide_variables = Tester::create_variables( 4, std::vector<int>{ -2000000000, -1, 0, 1, 2000000000 } );
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<LinearEquationEq>( variables_index, 5, std::vector<double>{ 2, -3, 1, 1 } ); };
+	EXPECT_TRUE( incremental_errors_match( make_constraint, wide_variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, wide_variables, true ) );
+}
+
+TEST_F(LinearEquationTest, SwapInvariance)
+{
+	// Only constraints with equal coefficients are swap-invariant
+	for( int i : { 1, 4, 5 } )
+		EXPECT_TRUE( swaps_keep_error( make_constraints[ i ], variables ) );
+	for( int i : { 0, 2, 3, 6 } )
+		EXPECT_FALSE( Tester::is_swap_invariant( *make_constraints[ i ]() ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
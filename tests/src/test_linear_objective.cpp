@@ -0,0 +1,72 @@
+#include <ghost/global_objectives/linear_objective.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class LinearObjectiveTest : public ::testing::Test
+{
+public:
+	// Variables 1 and 4 are out of the scope of the objective function.
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, -3, 8 );
+	std::vector<int> scope{ 0, 2, 3, 5 };
+	std::vector<double> coefficients{ 1.5, -2.0, 0.1, 3.0 };
+
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<ghost::global_objectives::LinearObjective<ghost::Minimize>>( scope, coefficients ); };
+	ObjectiveFactory make_maximization = [&](){ return std::make_shared<ghost::global_objectives::LinearObjective<ghost::Maximize>>( scope, coefficients ); };
+};
+
+TEST_F(LinearObjectiveTest, Cost)
+{
+	for( int id = 0 ; id < 6 ; ++id )
+		variables[ id ].set_value( id - 2 );
+
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *objective ), 1.5 * -2 - 2.0 * 0 + 0.1 * 1 + 3.0 * 3 );
+
+	auto maximization = make_maximization();
+	Tester::bind( *maximization, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *maximization ), -( 1.5 * -2 - 2.0 * 0 + 0.1 * 1 + 3.0 * 3 ) );
+}
+
+TEST_F(LinearObjectiveTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_objectives::LinearObjective<ghost::Minimize>( scope, { 1.0, 2.0, 3.0 } ), std::exception );
+	EXPECT_THROW( ghost::global_objectives::LinearObjective<ghost::Maximize>( Tester::create_variables( 2, 0, 3 ), { 1.0, 2.0, 3.0 } ), std::exception );
+}
+
+TEST_F(LinearObjectiveTest, DeltaCosts)
+{
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	Tester::cost( *objective );
+	EXPECT_TRUE( Tester::defines_delta_cost( *objective ) );
+
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false, 20000 ) );
+	EXPECT_TRUE( incremental_costs_match( make_maximization, variables, false, 20000 ) );
+}
+
+TEST_F(LinearObjectiveTest, SwapDeltaCosts)
+{
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+	EXPECT_TRUE( incremental_costs_match( make_maximization, variables, true ) );
+}
+
+TEST_F(LinearObjectiveTest, IsSeparable)
+{
+	EXPECT_TRUE( Tester::is_separable( *make_objective() ) );
+	EXPECT_TRUE( Tester::is_separable( *make_maximization() ) );
+}
+
+TEST_F(LinearObjectiveTest, CandidateCosts)
+{
+	EXPECT_TRUE( candidate_costs_match( make_objective, variables ) );
+	EXPECT_TRUE( candidate_costs_match( make_maximization, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,64 @@
+#include <ghost/global_constraints/no_overlap.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class NoOverlapTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 5, -2, 8 );
+	std::vector<int> durations{ 3, 1, 2, 4 };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::NoOverlap>( std::vector<int>{ 4, 0, 2, 1 }, durations ); };
+};
+
+TEST_F(NoOverlapTest, Error)
+{
+	auto constraint = std::make_shared<ghost::global_constraints::NoOverlap>( std::vector<int>{ 0, 1, 2 }, std::vector<int>{ 3, 1, 2 } );
+	Tester::bind( *constraint, variables );
+
+	// Task 0 runs over [0,3), task 1 over [1,2) and task 2 over [2,4)
+	variables[ 0 ].set_value( 0 );
+	variables[ 1 ].set_value( 1 );
+	variables[ 2 ].set_value( 2 );
+	EXPECT_EQ( Tester::error( *constraint ), 2 );
+
+	variables[ 2 ].set_value( 3 );
+	variables[ 1 ].set_value( -1 );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+}
+
+TEST_F(NoOverlapTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_constraints::NoOverlap( std::vector<int>{ 0, 1, 2 }, { 3, 1 } ), std::exception );
+}
+
+TEST_F(NoOverlapTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(NoOverlapTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(NoOverlapTest, SwapInvariance)
+{
+	EXPECT_FALSE( Tester::is_swap_invariant( *make_constraint() ) );
+
+	ConstraintFactory make_uniform_constraint = [](){ return std::make_shared<ghost::global_constraints::NoOverlap>( std::vector<int>{ 0, 1, 2, 3 }, std::vector<int>{ 2, 2, 2, 2 } ); };
+	EXPECT_TRUE( swaps_keep_error( make_uniform_constraint, variables ) );
+}
+
+TEST_F(NoOverlapTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,64 @@
+#include <ghost/global_constraints/not_equal_network.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+
+#include "constraint_tests.hpp"
+
+class NotEqualNetworkTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 7, 0, 3 );
+	// A 5-cycle over variables 1, 3, 4, 5, 6 with the chord (3,5)
+	std::vector<std::pair<int, int>> edges{ { 1, 3 }, { 3, 4 }, { 4, 5 }, { 5, 6 }, { 6, 1 }, { 3, 5 } };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::NotEqualNetwork>( std::vector<int>{ 1, 3, 4, 5, 6 }, edges ); };
+};
+
+TEST_F(NotEqualNetworkTest, Errors)
+{
+	auto constraint = make_constraint();
+	Tester::bind( *constraint, variables );
+
+	for( int i = 0 ; i < 7 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 2, 0, 2, 1, 1, 1, 2 }[ i ] );
+	Tester::initialize( *constraint );
+	EXPECT_EQ( Tester::error( *constraint ), 3 );
+
+	EXPECT_TRUE( Tester::defines_variable_error( *constraint ) );
+	EXPECT_EQ( Tester::variable_error( *constraint, 1 ), 0 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 3 ), 2 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 4 ), 2 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 5 ), 2 );
+	EXPECT_EQ( Tester::variable_error( *constraint, 6 ), 0 );
+}
+
+TEST_F(NotEqualNetworkTest, DeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+}
+
+TEST_F(NotEqualNetworkTest, SwapDeltaAndVariableErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+}
+
+TEST_F(NotEqualNetworkTest, DeltaAndVariableErrorsSparseDomains)
+{
+	// Domains spanning most of the int range must neither overflow nor allocate a count per value of the span
+	auto sparse_variables = Tester::create_variables( 7, std::vector<int>{ std::numeric_limits<int>::min(), 0, std::numeric_limits<int>::max() } );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_constraint, sparse_variables, true ) );
+}
+
+TEST_F(NotEqualNetworkTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
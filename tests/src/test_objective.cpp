@@ -0,0 +1,155 @@
+#include <ghost/objective.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+// Sum of squares, maintained incrementally with optional_delta_cost.
+template<typename Direction>
+class SumOfSquares : public Direction
+{
+	mutable double _sum;
+
+	double required_cost( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		_sum = 0.0;
+		for( auto variable : variables )
+			_sum += variable->get_value() * variable->get_value();
+		return _sum;
+	}
+
+	double optional_delta_cost( const std::vector<ghost::Variable*>& variables,
+	                            const std::vector<int>& indexes,
+	                            const std::vector<int>& candidate_values ) const override
+	{
+		double delta = 0.0;
+		for( int i = 0 ; i < static_cast<int>( indexes.size() ) ; ++i )
+			delta += candidate_values[ i ] * candidate_values[ i ] - variables[ indexes[ i ] ]->get_value() * variables[ indexes[ i ] ]->get_value();
+		return delta;
+	}
+
+	void conditional_update_data_structures( const std::vector<ghost::Variable*>& variables, int index, int new_value ) override
+	{
+		_sum += new_value * new_value - variables[ index ]->get_value() * variables[ index ]->get_value();
+	}
+
+public:
+	SumOfSquares( const std::vector<int>& variables_index )
+		: Direction( variables_index, "SumOfSquares" )
+	{ }
+};
+
+// Sum of products of consecutive variables, without optional_delta_cost.
+template<typename Direction>
+class ChainProducts : public Direction
+{
+	double required_cost( const std::vector<ghost::Variable*>& variables ) const override
+	{
+		double cost = 0.0;
+		for( int index = 0 ; index + 1 < static_cast<int>( variables.size() ) ; ++index )
+			cost += variables[ index ]->get_value() * variables[ index + 1 ]->get_value();
+		return cost;
+	}
+
+public:
+	ChainProducts( const std::vector<int>& variables_index )
+		: Direction( variables_index, "ChainProducts" )
+	{ }
+};
+
+class ObjectiveTest : public ::testing::Test
+{
+public:
+	// Variables 1, 4 and 7 are out of the scope of objective functions.
+	std::vector<ghost::Variable> variables = Tester::create_variables( 8, -3, 8 );
+	std::vector<int> scope{ 0, 2, 3, 5, 6 };
+};
+
+TEST_F(ObjectiveTest, DeltaCosts)
+{
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<SumOfSquares<ghost::Minimize>>( scope ); };
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	Tester::cost( *objective );
+	EXPECT_TRUE( Tester::defines_delta_cost( *objective ) );
+
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false ) );
+}
+
+TEST_F(ObjectiveTest, SwapDeltaCosts)
+{
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<SumOfSquares<ghost::Minimize>>( scope ); };
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+}
+
+TEST_F(ObjectiveTest, MaximizationDeltaCosts)
+{
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<SumOfSquares<ghost::Maximize>>( scope ); };
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false ) );
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+
+	variables[ 0 ].set_value( 2 );
+	variables[ 1 ].set_value( 3 );
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	double cost = Tester::cost( *objective );
+	Tester::defines_delta_cost( *objective );
+
+	// Costs are negated for maximization, and variables out of the scope do not change them.
+	EXPECT_DOUBLE_EQ( Tester::simulate_delta_cost( *objective, { 0 }, { 4 } ), -12.0 );
+	EXPECT_DOUBLE_EQ( Tester::simulate_delta_cost( *objective, { 1 }, { 4 } ), 0.0 );
+	EXPECT_DOUBLE_EQ( Tester::simulate_delta_cost( *objective, { 0, 1 }, { 3, 2 } ), -5.0 );
+	EXPECT_DOUBLE_EQ( Tester::cost( *objective ), cost );
+	EXPECT_EQ( variables[ 0 ].get_value(), 2 );
+}
+
+TEST_F(ObjectiveTest, SimulatedDeltaCosts)
+{
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<ChainProducts<ghost::Minimize>>( scope ); };
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	Tester::cost( *objective );
+	EXPECT_FALSE( Tester::defines_delta_cost( *objective ) );
+
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false ) );
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+
+	make_objective = [&](){ return std::make_shared<ChainProducts<ghost::Maximize>>( scope ); };
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false ) );
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+}
+
+TEST_F(ObjectiveTest, NotSeparableByDefault)
+{
+	EXPECT_FALSE( Tester::is_separable( SumOfSquares<ghost::Minimize>( scope ) ) );
+	EXPECT_FALSE( Tester::is_separable( ChainProducts<ghost::Maximize>( scope ) ) );
+}
+
+TEST_F(ObjectiveTest, CandidateCosts)
+{
+	EXPECT_TRUE( candidate_costs_match( [&](){ return std::make_shared<SumOfSquares<ghost::Minimize>>( scope ); }, variables ) );
+	EXPECT_TRUE( candidate_costs_match( [&](){ return std::make_shared<SumOfSquares<ghost::Maximize>>( scope ); }, variables ) );
+}
+
+TEST_F(ObjectiveTest, SimulatedCandidateCosts)
+{
+	EXPECT_TRUE( candidate_costs_match( [&](){ return std::make_shared<ChainProducts<ghost::Minimize>>( scope ); }, variables ) );
+	EXPECT_TRUE( candidate_costs_match( [&](){ return std::make_shared<ChainProducts<ghost::Maximize>>( scope ); }, variables ) );
+}
+
+TEST_F(ObjectiveTest, ParallelCandidateCosts)
+{
+	ObjectiveFactory make_objective = [&]()
+	{
+		auto objective = std::make_shared<ChainProducts<ghost::Minimize>>( scope );
+		objective->set_heuristic_value_threads( 3 );
+		return objective;
+	};
+	EXPECT_TRUE( candidate_costs_match( make_objective, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
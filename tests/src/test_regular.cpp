@@ -0,0 +1,85 @@
+#include <ghost/global_constraints/regular.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class RegularTest : public ::testing::Test
+{
+public:
+	// Value 2 is out of the alphabet of the automaton
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, 0, 3 );
+
+	// Words over {0,1} with no more than two 1s in a row, ending with 0. State q counts the trailing 1s.
+	std::vector<std::tuple<int, int, int>> transitions{ { 0, 0, 0 }, { 0, 1, 1 }, { 1, 0, 0 }, { 1, 1, 2 }, { 2, 0, 0 } };
+
+	ConstraintFactory make_constraint = [&](){ return std::make_shared<ghost::global_constraints::Regular>( std::vector<int>{ 5, 0, 1, 3, 4 }, 3, 0, std::vector<int>{ 0 }, transitions ); };
+
+	// Words of 1s of even length: only one word of length 4 is recognized
+	ConstraintFactory make_even_constraint = [](){ return std::make_shared<ghost::global_constraints::Regular>( std::vector<int>{ 2, 3, 4, 5 }, 2, 0, std::vector<int>{ 0 }, std::vector<std::tuple<int, int, int>>{ { 0, 1, 1 }, { 1, 1, 0 } } ); };
+};
+
+TEST_F(RegularTest, Error)
+{
+	auto constraint = std::make_shared<ghost::global_constraints::Regular>( std::vector<int>{ 0, 1, 2, 3, 4 }, 3, 0, std::vector<int>{ 0 }, transitions );
+	Tester::bind( *constraint, variables );
+
+	for( int i = 0 ; i < 5 ; ++i )
+		variables[ i ].set_value( std::vector<int>{ 1, 1, 1, 0, 0 }[ i ] );
+	EXPECT_EQ( Tester::error( *constraint ), 1 );
+
+	for( int i = 0 ; i < 5 ; ++i )
+		variables[ i ].set_value( 1 );
+	EXPECT_EQ( Tester::error( *constraint ), 2 );
+
+	variables[ 2 ].set_value( 2 );
+	EXPECT_EQ( Tester::error( *constraint ), 2 );
+
+	// No words of length 5 are recognized: the error is the length + 1
+	auto empty_language = std::make_shared<ghost::global_constraints::Regular>( std::vector<int>{ 0, 1, 2, 3, 4 }, 2, 0, std::vector<int>{ 0 }, std::vector<std::tuple<int, int, int>>{ { 0, 1, 1 }, { 1, 1, 0 } } );
+	Tester::bind( *empty_language, variables );
+	EXPECT_EQ( Tester::error( *empty_language ), 6 );
+}
+
+TEST_F(RegularTest, StateOutOfRange)
+{
+	using ghost::global_constraints::Regular;
+	std::vector<int> variables_index{ 0, 1, 2 };
+	EXPECT_THROW( Regular( variables_index, 3, 3, { 0 }, transitions ), std::exception );
+	EXPECT_THROW( Regular( variables_index, 3, -1, { 0 }, transitions ), std::exception );
+	EXPECT_THROW( Regular( variables_index, 3, 0, { 0, 3 }, transitions ), std::exception );
+	EXPECT_THROW( Regular( variables_index, 3, 0, { 0 }, { { 0, 0, 0 }, { 3, 1, 1 } } ), std::exception );
+	EXPECT_THROW( Regular( variables_index, 3, 0, { 0 }, { { 0, 0, 0 }, { 0, 1, 5 } } ), std::exception );
+}
+
+TEST_F(RegularTest, NonDeterministic)
+{
+	using ghost::global_constraints::Regular;
+	std::vector<int> variables_index{ 0, 1, 2 };
+	EXPECT_THROW( Regular( variables_index, 3, 0, { 0 }, { { 0, 0, 0 }, { 0, 1, 1 }, { 0, 1, 2 } } ), std::exception );
+	EXPECT_NO_THROW( Regular( variables_index, 3, 0, { 0 }, { { 0, 0, 0 }, { 0, 1, 1 }, { 0, 1, 1 } } ) );
+}
+
+TEST_F(RegularTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_even_constraint, variables, false ) );
+}
+
+TEST_F(RegularTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_constraint, variables, true ) );
+	EXPECT_TRUE( incremental_errors_match( make_even_constraint, variables, true ) );
+}
+
+TEST_F(RegularTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_constraint, variables ) );
+	EXPECT_TRUE( filter_keeps_supports( make_even_constraint, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,91 @@
+#include <ghost/global_objectives/separable_objective.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class SeparableObjectiveTest : public ::testing::Test
+{
+public:
+	// Variables 1 and 4 are out of the scope of the objective function.
+	std::vector<ghost::Variable> variables = Tester::create_variables( 6, -3, 8 );
+	std::vector<int> scope{ 0, 2, 3, 5 };
+	// Cost tables of values -3 to 4.
+	std::vector<std::vector<double>> costs{ { 5, 0, 2, 7, 1, 1, 3, 0.5 },
+	                                        { 0, 0, 0, 9, 0, 0, 0, 0 },
+	                                        { -1, -2, -3, -4, 4, 3, 2, 1 },
+	                                        { 0.25, 8, 0.75, 6, 1.25, 4, 1.75, 2 } };
+
+	ObjectiveFactory make_objective = [&](){ return std::make_shared<ghost::global_objectives::SeparableObjective<ghost::Minimize>>( scope, costs, -3 ); };
+	ObjectiveFactory make_maximization = [&](){ return std::make_shared<ghost::global_objectives::SeparableObjective<ghost::Maximize>>( scope, costs, -3 ); };
+};
+
+TEST_F(SeparableObjectiveTest, Cost)
+{
+	for( int id = 0 ; id < 6 ; ++id )
+		variables[ id ].set_value( id - 2 );
+
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *objective ), 0 + 9 + 4 + 1.75 );
+
+	auto maximization = make_maximization();
+	Tester::bind( *maximization, variables );
+	EXPECT_DOUBLE_EQ( Tester::cost( *maximization ), -( 0 + 9 + 4 + 1.75 ) );
+}
+
+TEST_F(SeparableObjectiveTest, SizeMismatch)
+{
+	EXPECT_THROW( ghost::global_objectives::SeparableObjective<ghost::Minimize>( scope, { costs[ 0 ] }, -3 ), std::exception );
+	EXPECT_THROW( ghost::global_objectives::SeparableObjective<ghost::Maximize>( Tester::create_variables( 2, -3, 8 ), costs, -3 ), std::exception );
+}
+
+TEST_F(SeparableObjectiveTest, TablesCoverDomains)
+{
+	auto short_costs = costs;
+	short_costs[ 2 ].pop_back();
+	auto scope_variables = Tester::create_variables( 4, -3, 8 );
+	EXPECT_THROW( ghost::global_objectives::SeparableObjective<ghost::Minimize>( scope_variables, short_costs, -3 ), std::exception );
+	EXPECT_THROW( ghost::global_objectives::SeparableObjective<ghost::Minimize>( scope_variables, costs, -2 ), std::exception );
+	EXPECT_NO_THROW( ghost::global_objectives::SeparableObjective<ghost::Minimize>( scope_variables, costs, -3 ) );
+
+	// Domains are unknown from variable IDs: tables are checked on the first cost computation.
+	ghost::global_objectives::SeparableObjective<ghost::Minimize> objective( scope, short_costs, -3 );
+	Tester::bind( objective, variables );
+	EXPECT_THROW( Tester::cost( objective ), std::exception );
+}
+
+TEST_F(SeparableObjectiveTest, DeltaCosts)
+{
+	auto objective = make_objective();
+	Tester::bind( *objective, variables );
+	Tester::cost( *objective );
+	EXPECT_TRUE( Tester::defines_delta_cost( *objective ) );
+
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, false ) );
+	EXPECT_TRUE( incremental_costs_match( make_maximization, variables, false ) );
+}
+
+TEST_F(SeparableObjectiveTest, SwapDeltaCosts)
+{
+	EXPECT_TRUE( incremental_costs_match( make_objective, variables, true ) );
+	EXPECT_TRUE( incremental_costs_match( make_maximization, variables, true ) );
+}
+
+TEST_F(SeparableObjectiveTest, IsSeparable)
+{
+	EXPECT_TRUE( Tester::is_separable( *make_objective() ) );
+	EXPECT_TRUE( Tester::is_separable( *make_maximization() ) );
+}
+
+TEST_F(SeparableObjectiveTest, CandidateCosts)
+{
+	EXPECT_TRUE( candidate_costs_match( make_objective, variables ) );
+	EXPECT_TRUE( candidate_costs_match( make_maximization, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,296 @@
+#include <ghost/solver.hpp>
+#include <ghost/global_constraints/all_different.hpp>
+#include <ghost/global_constraints/fix_value.hpp>
+#include <ghost/global_constraints/linear_equation_eq.hpp>
+#include <ghost/global_constraints/linear_equation_l.hpp>
+#include <ghost/global_objectives/linear_objective.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <set>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <string>
+
+// Independent pairs of variables (x_2i, x_2i+1) with x_2i < x_2i+1.
+class PairsBuilder : public ghost::ModelBuilder
+{
+	int _number_pairs;
+	bool _optimization;
+
+public:
+	PairsBuilder( int number_pairs, bool optimization = false )
+		: ModelBuilder(),
+		  _number_pairs( number_pairs ),
+		  _optimization( optimization )
+	{ }
+
+	void declare_variables() override
+	{
+		create_n_variables( 2 * _number_pairs, 0, 4 );
+	}
+
+	void declare_constraints() override
+	{
+		for( int i = 0 ; i < _number_pairs ; ++i )
+			constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationL>( std::vector<int>{ 2 * i, 2 * i + 1 }, 0, std::vector<double>{ 1, -1 } ) );
+	}
+
+	void declare_objective() override
+	{
+		if( !_optimization )
+		{
+			ModelBuilder::declare_objective();
+			return;
+		}
+
+		// Best pairs are (0,1), (0,1), (2,3) and (0,3), repeated
+		std::vector<double> first_coefficients{ 1, -1, 1, -1 };
+		std::vector<double> second_coefficients{ -2, -1, 1, 2 };
+		std::vector<int> variables_index( 2 * _number_pairs );
+		std::vector<double> coefficients( 2 * _number_pairs );
+		std::iota( variables_index.begin(), variables_index.end(), 0 );
+		for( int i = 0 ; i < _number_pairs ; ++i )
+		{
+			coefficients[ 2 * i ] = first_coefficients[ i % 4 ];
+			coefficients[ 2 * i + 1 ] = second_coefficients[ i % 4 ];
+		}
+		objective = std::make_shared<ghost::global_objectives::LinearObjective<ghost::Maximize>>( variables_index, coefficients );
+	}
+};
+
+// AllDifferent over variables with domain {0,...,domain_size-1}, the first variable being fixed to the last value.
+class AllDifferentBuilder : public ghost::ModelBuilder
+{
+	int _number_variables;
+	int _domain_size;
+
+public:
+	AllDifferentBuilder( int number_variables, int domain_size )
+		: ModelBuilder(),
+		  _number_variables( number_variables ),
+		  _domain_size( domain_size )
+	{ }
+
+	void declare_variables() override
+	{
+		create_n_variables( _number_variables, 0, _domain_size );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::FixValue>( std::vector<int>{ 0 }, _domain_size - 1 ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+	}
+};
+
+// Permutation of {0,...,5} such that 1*x_0 + 2*x_1 + ... + 6*x_5 = 50.
+class PermutationBuilder : public ghost::ModelBuilder
+{
+public:
+	PermutationBuilder()
+		: ModelBuilder( true )
+	{ }
+
+	void declare_variables() override
+	{
+		for( int value = 0 ; value < 6 ; ++value )
+			variables.emplace_back( 0, 6, value );
+	}
+
+	void declare_constraints() override
+	{
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::AllDifferent>( variables ) );
+		constraints.emplace_back( std::make_shared<ghost::global_constraints::LinearEquationEq>( variables, 50, std::vector<double>{ 1, 2, 3, 4, 5, 6 } ) );
+	}
+};
+
+// Each pair has 6 solutions over the domain {0,1,2,3}.
+TEST(SolverTest, CompleteSearchCombinesComponents)
+{
+	PairsBuilder builder( 4 );
+	ghost::Solver solver( builder );
+
+	std::vector<double> costs;
+	std::vector<std::vector<int>> solutions;
+	EXPECT_TRUE( solver.complete_search( costs, solutions ) );
+	EXPECT_EQ( solutions.size(), 1296 );
+	EXPECT_EQ( solver.get_statistics().number_solutions, 1296.0 );
+	EXPECT_EQ( std::set<std::vector<int>>( solutions.begin(), solutions.end() ).size(), 1296 );
+
+	for( const auto& solution : solutions )
+		for( int i = 0 ; i < 4 ; ++i )
+			EXPECT_LT( solution[ 2 * i ], solution[ 2 * i + 1 ] );
+
+	double cost;
+	std::vector<int> solution;
+	for( std::size_t index = 0 ; index < solutions.size() ; index += 97 )
+	{
+		EXPECT_TRUE( solver.get_solution( index, cost, solution ) );
+		EXPECT_EQ( solution, solutions[ index ] );
+		EXPECT_EQ( cost, costs[ index ] );
+	}
+	EXPECT_FALSE( solver.get_solution( solutions.size(), cost, solution ) );
+}
+
+TEST(SolverTest, CompleteSearchBestSolution)
+{
+	PairsBuilder builder( 4, true );
+	ghost::Solver solver( builder );
+
+	std::vector<double> costs;
+	std::vector<std::vector<int>> solutions;
+	EXPECT_TRUE( solver.complete_search( costs, solutions ) );
+	double best_cost = *std::max_element( costs.begin(), costs.end() );
+
+	double cost;
+	std::vector<int> solution;
+	ghost::Options options;
+	EXPECT_TRUE( solver.complete_search( cost, solution, std::chrono::microseconds::max(), options ) );
+	EXPECT_EQ( cost, best_cost );
+	EXPECT_THAT( solution, ::testing::ElementsAre( 0, 1, 0, 1, 2, 3, 0, 3 ) );
+	EXPECT_EQ( solver.get_statistics().optimization_cost, best_cost );
+}
+
+TEST(SolverTest, CompleteSearchScalesWithComponents)
+{
+	// 6^20 combinations, but only 20 components of 2 variables to explore
+	PairsBuilder builder( 20, true );
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	ghost::Options options;
+	EXPECT_TRUE( solver.complete_search( cost, solution, std::chrono::seconds( 10 ), options ) );
+	EXPECT_DOUBLE_EQ( solver.get_statistics().number_solutions, std::pow( 6.0, 20 ) );
+	EXPECT_LT( solver.get_statistics().nodes, 1000 );
+	EXPECT_EQ( cost, 5 * ( -2 - 1 + 5 + 6 ) );
+	for( int i = 0 ; i < 20 ; i += 4 )
+		EXPECT_THAT( std::vector<int>( solution.begin() + 2 * i, solution.begin() + 2 * i + 8 ), ::testing::ElementsAre( 0, 1, 0, 1, 2, 3, 0, 3 ) );
+}
+
+TEST(SolverTest, CompleteSearchNodeLimit)
+{
+	AllDifferentBuilder builder( 8, 8 );
+	ghost::Solver solver( builder );
+
+	std::vector<double> costs;
+	std::vector<std::vector<int>> solutions;
+	ghost::Options options;
+	options.node_limit = 50;
+	solver.complete_search( costs, solutions, options );
+	EXPECT_TRUE( solver.get_statistics().interrupted );
+	EXPECT_LE( solver.get_statistics().nodes, 50 );
+	EXPECT_LT( solutions.size(), 5040 );
+	for( const auto& solution : solutions )
+	{
+		EXPECT_EQ( solution[ 0 ], 7 );
+		EXPECT_EQ( std::set<int>( solution.begin(), solution.end() ).size(), 8 );
+	}
+
+	costs.clear();
+	solutions.clear();
+	options.node_limit = 0;
+	EXPECT_TRUE( solver.complete_search( costs, solutions, options ) );
+	EXPECT_FALSE( solver.get_statistics().interrupted );
+	EXPECT_EQ( solutions.size(), 5040 );
+}
+
+TEST(SolverTest, CompleteSearchCancellation)
+{
+	AllDifferentBuilder builder( 8, 8 );
+	ghost::Solver solver( builder );
+
+	std::vector<double> costs;
+	std::vector<std::vector<int>> solutions;
+	ghost::Options options;
+	options.cancel_search = std::make_shared<std::atomic<bool>>( true );
+	EXPECT_FALSE( solver.complete_search( costs, solutions, options ) );
+	EXPECT_TRUE( solver.get_statistics().interrupted );
+	EXPECT_EQ( solver.get_statistics().nodes, 0 );
+	EXPECT_TRUE( solutions.empty() );
+}
+
+TEST(SolverTest, CompleteSearchTimeout)
+{
+	AllDifferentBuilder builder( 10, 10 );
+	ghost::Solver solver( builder );
+
+	std::vector<double> costs;
+	std::vector<std::vector<int>> solutions;
+	auto start = std::chrono::steady_clock::now();
+	solver.complete_search( costs, solutions, std::chrono::milliseconds( 20 ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, std::chrono::seconds( 2 ) );
+	EXPECT_TRUE( solver.get_statistics().interrupted );
+	EXPECT_LT( solutions.size(), 362880 );
+}
+
+TEST(SolverTest, FastSearchPreprocessing)
+{
+	AllDifferentBuilder builder( 6, 6 );
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	ghost::Options options;
+	options.preprocessing = true;
+	EXPECT_TRUE( solver.fast_search( cost, solution, std::chrono::seconds( 10 ), options ) );
+	EXPECT_EQ( cost, 0 );
+	EXPECT_EQ( solution[ 0 ], 5 );
+	EXPECT_EQ( std::set<int>( solution.begin(), solution.end() ).size(), 6 );
+}
+
+TEST(SolverTest, FastSearchPreprocessingFailsFast)
+{
+	// 7 variables for 6 values: arc consistency empties a domain, so the solver does not search
+	AllDifferentBuilder builder( 7, 6 );
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	ghost::Options options;
+	options.preprocessing = true;
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_FALSE( solver.fast_search( cost, solution, std::chrono::seconds( 10 ), options ) );
+	EXPECT_LT( std::chrono::steady_clock::now() - start, std::chrono::seconds( 1 ) );
+	EXPECT_GT( cost, 0 );
+	EXPECT_EQ( solution.size(), 7 );
+}
+
+TEST(SolverTest, FastSearchPermutation)
+{
+	// AllDifferent is swap-invariant: its delta errors are not simulated, but its data structures must follow swaps
+	PermutationBuilder builder;
+	ghost::Solver solver( builder );
+
+	double cost;
+	std::vector<int> solution;
+	ghost::Options options;
+	options.seed = 0;
+	EXPECT_TRUE( solver.fast_search( cost, solution, std::chrono::seconds( 10 ), options ) );
+	EXPECT_EQ( cost, 0 );
+	EXPECT_EQ( std::set<int>( solution.begin(), solution.end() ).size(), 6 );
+	int sum = 0;
+	for( int i = 0 ; i < 6 ; ++i )
+		sum += ( i + 1 ) * solution[ i ];
+	EXPECT_EQ( sum, 50 );
+}
+
+TEST(SolverTest, StatisticsNumberOfSolutions)
+{
+	ghost::SolverStatistics statistics;
+	statistics.number_solutions = 1234567.0;
+	EXPECT_NE( statistics.to_json().find( "\"number_solutions\": 1234567," ), std::string::npos );
+	EXPECT_NE( statistics.to_csv().find( ",1234567," ), std::string::npos );
+
+	statistics.number_solutions = std::numeric_limits<double>::infinity();
+	EXPECT_NE( statistics.to_json().find( "\"number_solutions\": null," ), std::string::npos );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,59 @@
+#include <ghost/global_constraints/table.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "constraint_tests.hpp"
+
+class TableTest : public ::testing::Test
+{
+public:
+	std::vector<ghost::Variable> variables = Tester::create_variables( 3, 0, 4 );
+	std::vector<std::vector<int>> tuples{ { 0, 1, 2 }, { 1, 1, 1 }, { 3, 0, 2 }, { 2, 1, 0 }, { 0, 3, 3 }, { 1, 2, 3 }, { 3, 3, 3 } };
+
+	ConstraintFactory make_allowed = [&](){ return std::make_shared<ghost::global_constraints::Table>( std::vector<int>{ 0, 1, 2 }, tuples ); };
+	ConstraintFactory make_forbidden = [&](){ return std::make_shared<ghost::global_constraints::Table>( std::vector<int>{ 2, 0, 1 }, tuples, true ); };
+};
+
+TEST_F(TableTest, Error)
+{
+	auto constraint = make_allowed();
+	Tester::bind( *constraint, variables );
+
+	variables[0].set_value( 2 );
+	variables[1].set_value( 1 );
+	variables[2].set_value( 0 );
+	EXPECT_EQ( Tester::error( *constraint ), 0 );
+
+	variables[2].set_value( 1 );
+	EXPECT_EQ( Tester::error( *constraint ), 1 );
+}
+
+TEST_F(TableTest, TupleSizeMismatch)
+{
+	EXPECT_THROW( ghost::global_constraints::Table( std::vector<int>{ 0, 1, 2 }, { { 0, 1, 2 }, { 1, 1 } } ), std::exception );
+	EXPECT_THROW( ghost::global_constraints::Table( std::vector<int>{ 0, 1 }, { { 0, 1, 2 } }, true ), std::exception );
+}
+
+TEST_F(TableTest, DeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_allowed, variables, false ) );
+	EXPECT_TRUE( incremental_errors_match( make_forbidden, variables, false ) );
+}
+
+TEST_F(TableTest, SwapDeltaErrors)
+{
+	EXPECT_TRUE( incremental_errors_match( make_allowed, variables, true ) );
+	EXPECT_TRUE( incremental_errors_match( make_forbidden, variables, true ) );
+}
+
+TEST_F(TableTest, FilterKeepsSupports)
+{
+	EXPECT_TRUE( filter_keeps_supports( make_allowed, variables ) );
+	EXPECT_TRUE( filter_keeps_supports( make_forbidden, variables ) );
+}
+
+int main(int argc, char **argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}